@@ -5,40 +5,8 @@
 // the similar parts, done this way (rather than functions) to avoid call
 // overhead in lowest-level functions. Don't fret about this being "too
 // big," as most projects will likely only invoke a single class, not like
-// every variant gets instantiated.
-
-#ifndef _swap_int16_t
-#define _swap_int16_t(a, b)                                                    \
-  {                                                                            \
-    int16_t t = a;                                                             \
-    a = b;                                                                     \
-    b = t;                                                                     \
-  }
-#endif
-
-// This does GFX-style "soft rotation" in each drawPixel():
-#define _IS31_ROTATE_(_X_, _Y_)                                                \
-  switch (getRotation()) {                                                     \
-  case 1:                                                                      \
-    _swap_int16_t(_X_, _Y_);                                                   \
-    _X_ = WIDTH - 1 - _X_;                                                     \
-    break;                                                                     \
-  case 2:                                                                      \
-    _X_ = WIDTH - 1 - _X_;                                                     \
-    _Y_ = HEIGHT - 1 - _Y_;                                                    \
-    break;                                                                     \
-  case 3:                                                                      \
-    _swap_int16_t(_X_, _Y_);                                                   \
-    _Y_ = HEIGHT - 1 - _Y_;                                                    \
-    break;                                                                     \
-  }
-
-// This expands a GFX-style RGB565 color to RGB888 in 3 uint8_t variables,
-// declared here, i.e. at the corresponding position in the drawPixel() func.
-#define _IS31_EXPAND_(_COLOR_, _R_, _G_, _B_)                                  \
-  uint8_t _R_ = ((_COLOR_ >> 8) & 0xF8) | (_COLOR_ >> 13);                     \
-  uint8_t _G_ = ((_COLOR_ >> 3) & 0xFC) | ((_COLOR_ >> 9) & 0x03);             \
-  uint8_t _B_ = ((_COLOR_ << 3) & 0xF8) | ((_COLOR_ >> 2) & 0x07);
+// every variant gets instantiated. The rotate and expand macros are in the
+// header, as the board class templates there use them.
 
 // This scales a packed 24-bit RGB value by a brightness level (0-255) and
 // places in 3 uint8_t variables declared here, i.e. at the corresponding
@@ -72,14 +40,15 @@ bool Adafruit_IS31FL3741::begin(uint8_t addr, TwoWire *theWire) {
   delete _i2c_dev;
   _i2c_dev = new Adafruit_I2CDevice(addr, theWire);
 
-  if (_i2c_dev->begin()) {
+  if (counted(_i2c_dev->begin(), 0)) { // Address probe, no data
     // User code can set this faster if it wants, this is simply
     // the max ordained I2C speed on AVR.
     _i2c_dev->setSpeed(400000);
 
     Adafruit_BusIO_Register id_reg =
         Adafruit_BusIO_Register(_i2c_dev, IS3741_IDREGISTER);
-    if ((id_reg.read() == (addr * 2)) && reset()) {
+    uint8_t id;
+    if (countedRead(id_reg.read(&id)) && (id == (addr * 2)) && reset()) {
       return true; // Success!
     }
   }
@@ -94,10 +63,13 @@ bool Adafruit_IS31FL3741::begin(uint8_t addr, TwoWire *theWire) {
 */
 /**************************************************************************/
 bool Adafruit_IS31FL3741::reset(void) {
+  _batchCount = 0; // Any queued LED writes would be wiped by reset anyway
   selectPage(4);
   Adafruit_BusIO_Register reset_reg =
       Adafruit_BusIO_Register(_i2c_dev, IS3741_FUNCREG_RESET);
-  return reset_reg.write(0xAE);
+  bool status = counted(reset_reg.write(0xAE), 2);
+  _gcc = _gccOut = _scale = status ? 0 : -1; // Power-on values, if reset OK
+  return status;
 }
 
 /**************************************************************************/
@@ -111,36 +83,57 @@ bool Adafruit_IS31FL3741::enable(bool en) {
   selectPage(4);
   Adafruit_BusIO_Register config_reg =
       Adafruit_BusIO_Register(_i2c_dev, IS3741_FUNCREG_CONFIG);
-  Adafruit_BusIO_RegisterBits shutdown_bit =
-      Adafruit_BusIO_RegisterBits(&config_reg, 1, 0);
-  return shutdown_bit.write(en);
+  // Read-modify-write of the shutdown bit, other bits left as they are
+  uint8_t config;
+  if (!countedRead(config_reg.read(&config)))
+    return false;
+  return counted(config_reg.write((config & ~1) | en), 2);
 }
 
 /**************************************************************************/
 /*!
     @brief    Set global current-mirror from 0 (off) to 255 (brightest).
+              If a buffered object's power limit (see setPowerLimit()) is
+              in effect, the value written may be lower.
     @param    current  8-bit level, 0 to 255.
     @returns  true if I2C command acknowledged, false on error.
 */
 /**************************************************************************/
 bool Adafruit_IS31FL3741::setGlobalCurrent(uint8_t current) {
+  _gcc = current;
+  return writeGlobalCurrent(min((int)current, (int)_gccCap));
+}
+
+/**************************************************************************/
+/*!
+    @brief    Write global current-mirror register, without changing the
+              level requested by setGlobalCurrent().
+    @param    current  8-bit level, 0 to 255.
+    @returns  true if I2C command acknowledged, false on error.
+*/
+/**************************************************************************/
+bool Adafruit_IS31FL3741::writeGlobalCurrent(uint8_t current) {
   selectPage(4);
   Adafruit_BusIO_Register gcurr_reg =
       Adafruit_BusIO_Register(_i2c_dev, IS3741_FUNCREG_GCURRENT);
-  return gcurr_reg.write(current);
+  bool status = counted(gcurr_reg.write(current), 2);
+  _gccOut = status ? current : -1;
+  return status;
 }
 
 /**************************************************************************/
 /*!
     @brief    Get the global current-mirror register setting.
-    @returns  0 (off) to 255 (brightest)
+    @returns  0 (off) to 255 (brightest), 0 if the read fails.
 */
 /**************************************************************************/
 uint8_t Adafruit_IS31FL3741::getGlobalCurrent(void) {
   selectPage(4);
   Adafruit_BusIO_Register gcurr_reg =
       Adafruit_BusIO_Register(_i2c_dev, IS3741_FUNCREG_GCURRENT);
-  return gcurr_reg.read();
+  uint8_t current = 0;
+  countedRead(gcurr_reg.read(&current));
+  return current;
 }
 
 /**************************************************************************/
@@ -152,7 +145,10 @@ uint8_t Adafruit_IS31FL3741::getGlobalCurrent(void) {
 bool Adafruit_IS31FL3741::unlock(void) {
   Adafruit_BusIO_Register lock_reg =
       Adafruit_BusIO_Register(_i2c_dev, IS3741_COMMANDREGISTERLOCK);
-  return lock_reg.write(0xC5);
+#if defined(IS3741_STATS)
+  _stats.unlocks++;
+#endif
+  return counted(lock_reg.write(0xC5), 2);
 }
 
 /**************************************************************************/
@@ -167,14 +163,20 @@ bool Adafruit_IS31FL3741::unlock(void) {
 bool Adafruit_IS31FL3741::selectPage(uint8_t page) {
   if (page < 5) {        // Valid page number?
     if (page == _page) { // If it matches the existing setting...
-      return true;       // nice, we can skip re-setting the page!
+#if defined(IS3741_STATS)
+      _stats.pageHits++;
+#endif
+      return true; // nice, we can skip re-setting the page!
     }
     _page = page; // Cache this page value
+#if defined(IS3741_STATS)
+    _stats.pageMisses++;
+#endif
 
     unlock();
     Adafruit_BusIO_Register cmd_reg =
         Adafruit_BusIO_Register(_i2c_dev, IS3741_COMMANDREGISTER);
-    return cmd_reg.write(page);
+    return counted(cmd_reg.write(page), 2);
   }
   return false; // Invalid page
 }
@@ -199,18 +201,144 @@ bool Adafruit_IS31FL3741::setLEDvalue(uint8_t first_page, uint16_t lednum,
   if (lednum < 351) {
     uint8_t cmd[2];
     cmd[1] = value;
-    if (lednum < 180) {
-      cmd[0] = (uint8_t)lednum;
-      selectPage(first_page);
-    } else {
-      cmd[0] = (uint8_t)(lednum - 180);
-      selectPage(first_page + 1);
+    if (lednum >= 180) {
+      lednum -= 180;
+      first_page++;
+    }
+    cmd[0] = (uint8_t)lednum;
+    if (_batchDepth && _batchSize) { // Batching? Queue it, flush if full
+      if ((_batchCount >= _batchSize) && !flushBatch())
+        return false;
+      IS3741_batchEntry &e = _batch[_batchCount++];
+      e.page = first_page;
+      e.reg = cmd[0];
+      e.value = value;
+      return true;
     }
-    return _i2c_dev->write(cmd, 2);
+    selectPage(first_page);
+    return counted(_i2c_dev->write(cmd, 2), 2);
   }
   return false;
 }
 
+/**************************************************************************/
+/*!
+    @brief    End a series of batched LED writes started with beginBatch().
+              If this is the outermost endBatch(), queued writes are sent.
+    @returns  true if I2C transfers completed successfully, false on error.
+*/
+/**************************************************************************/
+bool Adafruit_IS31FL3741::endBatch(void) {
+  if (_batchDepth && !--_batchDepth)
+    return flushBatch();
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Provide the queue that beginBatch() holds LED writes in. Direct
+            GFX boards come with one of IS3741_BATCH_SIZE entries; this
+            can replace it with a larger (or smaller) one, or give a plain
+            Adafruit_IS31FL3741 a queue. Anything already queued is sent
+            first.
+    @param  queue  Array of IS3741_batchEntry, which must outlive this
+                   object (or the next setBatchQueue() call). NULL to
+                   disable batching.
+    @param  size   Number of entries in queue, up to 255.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741::setBatchQueue(IS3741_batchEntry *queue,
+                                        uint8_t size) {
+  if (_batchCount)
+    flushBatch();
+  _batch = queue;
+  _batchSize = queue ? size : 0;
+}
+
+#if defined(IS3741_STATS)
+/**************************************************************************/
+/*!
+    @brief  Zero the I2C traffic and timing counters returned by
+            getStats().
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741::resetStats(void) {
+  memset(&_stats, 0, sizeof _stats);
+  _stats.showMin = 0xFFFFFFFF;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Record the duration of a show() in the stats block; used by
+            buffered subclasses, not directly.
+    @param  us  Elapsed time in microseconds.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741::countShow(uint32_t us) {
+  _stats.showLast = us;
+  if (us < _stats.showMin)
+    _stats.showMin = us;
+  if (us > _stats.showMax)
+    _stats.showMax = us;
+}
+#endif
+
+// Sort key for a queued write: page (MSB) and register (LSB)
+static inline uint16_t batchKey(const IS3741_batchEntry &e) {
+  return ((uint16_t)e.page << 8) | e.reg;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Send queued LED writes; used by endBatch() and when the queue
+              fills, not directly. Writes are sorted by page and register,
+              so each page is selected at most once and writes to adjacent
+              registers are merged into single auto-increment transfers.
+              If a register was written more than once, the last value is
+              used.
+    @returns  true if I2C transfers completed successfully, false on error.
+*/
+/**************************************************************************/
+bool Adafruit_IS31FL3741::flushBatch(void) {
+  // Insertion sort is fine for a short queue, and is stable, so repeat
+  // writes to the same register stay in the order they were made.
+  for (uint8_t i = 1; i < _batchCount; i++) {
+    IS3741_batchEntry e = _batch[i];
+    uint16_t key = batchKey(e);
+    uint8_t j = i;
+    for (; j && (batchKey(_batch[j - 1]) > key); j--)
+      _batch[j] = _batch[j - 1];
+    _batch[j] = e;
+  }
+
+  // Same "safe bet" 32 byte transfer size as fillTwoPages() below.
+  uint8_t buf[32];
+  uint8_t len = 0; // Number of values in buf (after address byte)
+  uint16_t next = 0;
+  bool status = true;
+  for (uint8_t i = 0; i < _batchCount; i++) {
+    const IS3741_batchEntry &e = _batch[i];
+    uint16_t reg = batchKey(e);
+    if (((i + 1) < _batchCount) && (batchKey(_batch[i + 1]) == reg))
+      continue; // Overwritten later in queue, skip it
+    if (len && ((reg != next) || (len == (sizeof buf - 1)))) {
+      status &= counted(_i2c_dev->write(buf, len + 1), len + 1); // +1 addr
+      len = 0;
+    }
+    if (!len) { // Starting a new transfer
+      selectPage(e.page);
+      buf[0] = e.reg;
+    }
+    buf[++len] = e.value;
+    next = reg + 1;
+  }
+  if (len)
+    status &= counted(_i2c_dev->write(buf, len + 1), len + 1);
+
+  _batchCount = 0;
+  return status;
+}
+
 /**************************************************************************/
 /*!
     @brief    Fill two pages of IS31FL3741 registers related to PWM levels
@@ -223,6 +351,9 @@ bool Adafruit_IS31FL3741::setLEDvalue(uint8_t first_page, uint16_t lednum,
 */
 /**************************************************************************/
 bool Adafruit_IS31FL3741::fillTwoPages(uint8_t first_page, uint8_t value) {
+  if (_batchCount) // Anything queued must go out before the fill
+    flushBatch();
+
   // The maximum I2C transfer size can be queried at run-time, but not
   // compile-time. Since we want a simple static-size buffer declared here,
   // we'll use the "safe bet" 32 byte transfer size, as requesting a large
@@ -240,7 +371,8 @@ bool Adafruit_IS31FL3741::fillTwoPages(uint8_t first_page, uint8_t value) {
     while (page_bytes) { // While there's data to write for page...
       uint8_t bytesThisPass = min((int)page_bytes, 31);
       buf[0] = addr;
-      if (!_i2c_dev->write(buf, bytesThisPass + 1)) // +1 for addr
+      if (!counted(_i2c_dev->write(buf, bytesThisPass + 1), // +1 for addr
+                   bytesThisPass + 1))
         return false;
       page_bytes -= bytesThisPass;
       addr += bytesThisPass;
@@ -264,6 +396,7 @@ bool Adafruit_IS31FL3741::fillTwoPages(uint8_t first_page, uint8_t value) {
 */
 /**************************************************************************/
 bool Adafruit_IS31FL3741::setLEDscaling(uint16_t lednum, uint8_t scale) {
+  _scale = -1;                          // LEDs may now differ
   return setLEDvalue(2, lednum, scale); // Scaling is on pages 2/3
 }
 
@@ -276,7 +409,47 @@ bool Adafruit_IS31FL3741::setLEDscaling(uint16_t lednum, uint8_t scale) {
 */
 /**************************************************************************/
 bool Adafruit_IS31FL3741::setLEDscaling(uint8_t scale) {
-  return fillTwoPages(2, scale); // Fill pages 2 & 3 with value
+  bool status = fillTwoPages(2, scale); // Fill pages 2 & 3 with value
+  _scale = status ? scale : -1;
+  return status;
+}
+
+// Below this global current, setBrightness() steps would be visibly
+// coarse, so the LED scaling registers are used for finer control.
+#define IS3741_FINE_GCC 32
+
+/**************************************************************************/
+/*!
+    @brief    Set overall brightness in hardware, without changing LED PWM
+              values. Light output follows a perceptual (squared) curve,
+              spread over the global current register and, for the lowest
+              levels where its steps would be visible, the scaling
+              registers of all LEDs. Registers are only written if their
+              value changes, so a fade usually costs a single 1-byte write
+              per step (scaling, 351 bytes, changes only at low levels).
+              This takes over LED scaling, replacing any per-LED values.
+    @param    b  Brightness, 0 (off) to 255 (full global current and
+                 scaling).
+    @returns  true if I2C transfers completed successfully, false on error.
+*/
+/**************************************************************************/
+bool Adafruit_IS31FL3741::setBrightness(uint8_t b) {
+  // Output is proportional to global current * scaling, each 0-255.
+  // Perceived brightness is (very roughly) the square root of output.
+  uint16_t target = b * b;
+  uint8_t gcc = (target + 127) / 255, scale = 255;
+  if (!target) {
+    scale = (_scale >= 0) ? _scale : 255; // Off; leave scaling as it was
+  } else if (gcc < IS3741_FINE_GCC) {
+    gcc = (target + 254) / 255;       // Least current that can reach it,
+    scale = (target + gcc / 2) / gcc; // then make up the rest in scaling
+  }
+  bool status = true;
+  if (scale != _scale)
+    status = setLEDscaling(scale);
+  if ((gcc != _gcc) || (_gccOut < 0))
+    status &= setGlobalCurrent(gcc);
+  return status;
 }
 
 /**************************************************************************/
@@ -445,7 +618,22 @@ uint32_t Adafruit_IS31FL3741::gamma32(uint32_t x) {
 */
 /**************************************************************************/
 Adafruit_IS31FL3741_buffered::Adafruit_IS31FL3741_buffered()
-    : Adafruit_IS31FL3741() {}
+    : Adafruit_IS31FL3741() {
+  markDirty();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Destructor for buffered IS31FL3741. Frees the showAsync()
+            buffer, color correction tables and power model state, if
+            allocated.
+*/
+/**************************************************************************/
+Adafruit_IS31FL3741_buffered::~Adafruit_IS31FL3741_buffered() {
+  free(asyncbuf);
+  free(lut);
+  free(power);
+}
 
 /**************************************************************************/
 /*!
@@ -459,48 +647,500 @@ bool Adafruit_IS31FL3741_buffered::begin(uint8_t addr, TwoWire *theWire) {
   bool status = Adafruit_IS31FL3741::begin(addr, theWire);
   if (status) {                        // If I2C initialized OK,
     memset(ledbuf, 0, sizeof(ledbuf)); // clear the LED buffer
+    markDirty();                       // and send all on next show()
   }
   return status;
 }
 
 /**************************************************************************/
 /*!
-    @brief  Push buffered LED data from RAM to device.
-    @note   This looks a lot like the base class' fillTwoPages() function,
-            but works differently and they are not interchangeable or
-            refactorable into a single function. This relies on the LED
-            buffer that's part of the Adafruit_IS31FL3741_buffered object
-            and does some temporary element swaps to make larger transfers
-            if the host device allows. Really, don't.
+    @brief  Flag a range of LEDs as changed, so next show() will send them.
+    @param  first  Index of first LED in range, 0 to 350.
+    @param  count  Number of LEDs in range. Any portion extending past the
+                   last LED is ignored.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_buffered::markDirty(uint16_t first, uint16_t count) {
+  uint16_t end = ((uint32_t)first + count > 351) ? 351 : first + count;
+  while ((first < end) && (first & 7)) // Leading partial byte
+    markDirty(first++);
+  while ((end - first) >= 8) { // Whole bytes
+    dirty[first >> 3] = 0xFF;
+    first += 8;
+  }
+  while (first < end) // Trailing partial byte
+    markDirty(first++);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Push buffered LED data from RAM to device. Only spans of LEDs
+            changed since the prior show() are sent (see markDirty()),
+            and a page with no changes is skipped entirely. If a prior
+            showAsync() is still in progress, that's finished first. If
+            color correction is in use (see setGamma() and friends),
+            values are passed through its tables on the way out; the LED
+            buffer itself is unchanged.
 */
 /**************************************************************************/
 void Adafruit_IS31FL3741_buffered::show(void) {
-  uint8_t *ptr = ledbuf;
+  waitShow();
+#if defined(IS3741_STATS)
+  uint32_t startTime = micros();
+#endif
+  bool correct = updateLUT();
+  if (fullRefresh)
+    markDirty();
+  int16_t gcc = updatePower(correct);
+  if ((gcc >= 0) && (gcc < _gccOut)) // Dim before sending brighter frame
+    writeGlobalCurrent(gcc);
+
+  uint16_t led = skipClean(dirty, 0);
+  while (led < 351)
+    led = sendSpan(ledbuf, dirty, led, correct);
+  memset(dirty, 0, sizeof dirty);
+  if ((gcc >= 0) && (gcc != _gccOut)) // Brighten after sending dim frame
+    writeGlobalCurrent(gcc);
+#if defined(IS3741_STATS)
+  countShow(micros() - startTime);
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief    Start pushing buffered LED data from RAM to device, without
+              waiting for it to finish. The frame is copied to a second
+              buffer (allocated on first use, 396 bytes) and then sent a
+              piece at a time by calls to poll(), so drawing of the next
+              frame can proceed in the meantime. If a prior showAsync() is
+              still in progress, that's finished first.
+    @returns  true if transfer was started, false if the second buffer
+              could not be allocated (the frame is then sent immediately
+              with show() instead).
+*/
+/**************************************************************************/
+bool Adafruit_IS31FL3741_buffered::showAsync(void) {
+  waitShow();
+  if (!asyncbuf) {
+    // One allocation holds LED data and its changed-LED mask
+    if (!(asyncbuf = (uint8_t *)malloc(sizeof ledbuf + sizeof dirty))) {
+      show();
+      return false;
+    }
+  }
+  bool correct = updateLUT();
+  if (fullRefresh)
+    markDirty();
+  int16_t gcc = updatePower(correct);
+  if ((gcc >= 0) && (gcc < _gccOut)) // As in show(), dim before sending
+    writeGlobalCurrent(gcc);
+  else if (gcc > _gccOut) // but brighten after, when poll() is done
+    power->gccPending = gcc;
+
+  uint8_t *asyncdirty = &asyncbuf[sizeof ledbuf];
+  if (correct) { // Color-correct the copy, poll() then sends it as-is
+    for (uint16_t i = 0; i < 351; i++)
+      asyncbuf[i + 1] = lutValue(i, ledbuf[i + 1]);
+  } else {
+    memcpy(asyncbuf, ledbuf, sizeof ledbuf);
+  }
+  memcpy(asyncdirty, dirty, sizeof dirty);
+  memset(dirty, 0, sizeof dirty);
+  asyncled = skipClean(asyncdirty, 0);
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Continue a transfer started with showAsync(), sending at most
+            one I2C transaction's worth of data per call. Call this
+            frequently (e.g. each pass through loop()); does nothing if no
+            transfer is in progress.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_buffered::poll(void) {
+  if (asyncled < 351) {
+    asyncled = sendSpan(asyncbuf, &asyncbuf[sizeof ledbuf], asyncled);
+    if ((asyncled >= 351) && power && (power->gccPending >= 0)) {
+      writeGlobalCurrent(power->gccPending); // Power limit, see showAsync()
+      power->gccPending = -1;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief    Skip over unchanged LEDs, as flagged in a changed-LED mask,
+              adding them to the skipped-bytes count.
+    @param    mask  Changed-LED bitmask (e.g. dirty[]).
+    @param    led   Index of first LED to consider, 0 to 350.
+    @returns  Index of next changed LED at or after led, or 351 if none.
+*/
+/**************************************************************************/
+uint16_t Adafruit_IS31FL3741_buffered::skipClean(const uint8_t *mask,
+                                                 uint16_t led) {
+  uint16_t start = led;
+  while (led < 351) {
+    if (!(led & 7) && !mask[led >> 3]) { // Skip 8 unchanged LEDs at once
+      led += 8;
+    } else if (!(mask[led >> 3] & (1 << (led & 7)))) { // Skip 1 LED
+      led++;
+    } else {
+      break; // Found a changed LED
+    }
+  }
+  led = min((int)led, 351); // Skipping by 8 may overshoot the end
+  bytesSkipped += led - start;
+  return led;
+}
+
+// A new I2C transfer costs a couple bytes (device & register address) on
+// top of its payload, so it's cheaper to bridge short runs of unchanged
+// LEDs between two changed spans than to start a new transfer.
+#define IS3741_DIRTY_GAP 3
+
+/**************************************************************************/
+/*!
+    @brief    Send one span of changed LEDs to device as a single I2C
+              transaction; used by show() and poll(), not directly.
+    @param    buf   LED buffer, with the extra leading byte (e.g. ledbuf).
+    @param    mask  Changed-LED bitmask corresponding to buf.
+    @param    led   Index of first changed LED of span, 0 to 350.
+    @param    correct  If true, pass values through color correction
+                       tables (which must be current, see updateLUT()).
+    @returns  Index of next changed LED after this span, or 351 if none.
+    @note     This looks a lot like the base class' fillTwoPages() function,
+              but works differently and they are not interchangeable or
+              refactorable into a single function. This relies on the LED
+              buffer that's part of the Adafruit_IS31FL3741_buffered object
+              and does some temporary element swaps to make larger transfers
+              if the host device allows. Really, don't.
+*/
+/**************************************************************************/
+uint16_t Adafruit_IS31FL3741_buffered::sendSpan(uint8_t *buf,
+                                                const uint8_t *mask,
+                                                uint16_t led,
+                                                bool correct) {
   uint8_t chunk = _i2c_dev->maxBufferSize() - 1;
+  if (correct && (chunk > 31)) // Corrected values are staged in buf32
+    chunk = 31;
+  uint8_t page = (led >= 180);           // First page is 180 bytes of stuff,
+  uint16_t page_start = page ? 180 : 0;  // subsequent page is smaller
+  uint16_t page_end = page ? 351 : 180;
+
+  // Extend span until the I2C transfer limit or page end, or until a run
+  // of unchanged LEDs is long enough to warrant a separate transfer.
+  uint16_t first = led, last = led;
+  while ((++led < page_end) && ((led - first) < chunk)) {
+    if (mask[led >> 3] & (1 << (led & 7))) {
+      last = led;
+    } else if ((led - last) > IS3741_DIRTY_GAP) {
+      break;
+    }
+  }
+  uint8_t bytesThisPass = last - first + 1;
+
+  selectPage(page);
+  if (correct) {
+    uint8_t buf32[32]; // Same "safe bet" transfer size as fillTwoPages()
+    buf32[0] = first - page_start; // Register address
+    for (uint8_t i = 0; i < bytesThisPass; i++)
+      buf32[i + 1] = lutValue(first + i, buf[first + i + 1]);
+    counted(_i2c_dev->write(buf32, bytesThisPass + 1), bytesThisPass + 1);
+    bytesSent += bytesThisPass;
+    return skipClean(mask, last + 1);
+  }
+  // To avoid needing an extra I2C write buffer here (whose size may
+  // vary by architecture, not knowable at compile-time), save the
+  // buffer value at ptr, overwrite with the current register address,
+  // write straight from buffer and then restore the saved value.
+  // This is why there's an extra leading byte used in ledbuf.
+  // All the LED-setting functions use getBuffer(), which returns
+  // a pointer to the first LED at position #1, not #0.
+  uint8_t *ptr = &buf[first]; // Byte BEFORE the first LED sent
+  uint8_t save = *ptr;
+  *ptr = first - page_start;               // Register address
+  counted(_i2c_dev->write(ptr, bytesThisPass + 1), // +1 for addr
+          bytesThisPass + 1);
+  *ptr = save;
+  bytesSent += bytesThisPass;
+
+  return skipClean(mask, last + 1);
+}
 
-  uint8_t page_bytes = 180; // First page is 180 bytes of stuff
-  for (uint8_t page = 0; page < 2; page++) {
-    selectPage(page);
-    uint8_t addr = 0;    // Writes always start at reg 0 within page
-    while (page_bytes) { // While there's data to write for page...
-      uint8_t bytesThisPass = min(page_bytes, chunk);
-      // To avoid needing an extra I2C write buffer here (whose size may
-      // vary by architecture, not knowable at compile-time), save the
-      // ledbuf value at ptr, overwrite with the current register address,
-      // write straight from ledbuf and then restore the saved value.
-      // This is why there's an extra leading byte used in ledbuf.
-      // All the LED-setting functions use getBuffer(), which returns
-      // a pointer to the first LED at position #1, not #0.
-      uint8_t save = *ptr;
-      *ptr = addr;
-      _i2c_dev->write(ptr, bytesThisPass + 1); // +1 for addr
-      *ptr = save;
-      page_bytes -= bytesThisPass;
-      ptr += bytesThisPass;
-      addr += bytesThisPass;
+// Show-time color correction. Three 256-byte tables (red, green, blue)
+// compose gamma, white balance and brightness, alongside a packed
+// 2-bit-per-LED map of which table each LED uses (3 = none, brightness
+// only) and the three gamma curves alone. All of this, and the settings,
+// is one allocation (IS3741_lut) made on first use, so objects not using
+// color correction don't carry it. The curves need pow() and are only
+// recomputed when setGamma() changes them; white balance and brightness
+// changes just rescale the curves into the tables with integer math. LED
+// buffer contents are left linear; only the values sent to the chip
+// change.
+
+/**************************************************************************/
+/*!
+    @brief  Set color correction exponent for all channels, applied by
+            show() to each LED value on its way to the chip. Unlike
+            gamma8(), drawing code uses linear values throughout. The
+            first color correction call allocates about 1.6K for tables;
+            if that fails, the call does nothing and LEDs are sent
+            uncorrected. Gamma curves are computed here (using
+            floating-point math, so not instant); the next show() only
+            rescales them. Also marks all LEDs as changed.
+    @param  gamma  Exponent, e.g. 2.6 for the gamma8() curve, or 1.0 for
+                   linear.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_buffered::setGamma(float gamma) {
+  setGamma(gamma, gamma, gamma);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set color correction exponent per channel. As with the single
+            value setGamma(), this takes effect on the next show().
+    @param  r  Red exponent, e.g. 2.6, or 1.0 for linear.
+    @param  g  Green exponent.
+    @param  b  Blue exponent.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_buffered::setGamma(float r, float g, float b) {
+  if (allocLUT() && ((r != lut->gamma[0]) || (g != lut->gamma[1]) ||
+                     (b != lut->gamma[2]))) {
+    lut->gamma[0] = r;
+    lut->gamma[1] = g;
+    lut->gamma[2] = b;
+    updateGamma();
+    lut->stale = true;
+    markDirty();
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set color correction white point, i.e. the maximum level of
+            each channel, applied by show() after gamma. Useful where one
+            color of LED is noticeably brighter than the others. Takes
+            effect on the next show().
+    @param  r  Red maximum, 0 to 255 (default).
+    @param  g  Green maximum, 0 to 255 (default).
+    @param  b  Blue maximum, 0 to 255 (default).
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_buffered::setWhiteBalance(uint8_t r, uint8_t g,
+                                                   uint8_t b) {
+  if (allocLUT() && ((r != lut->white[0]) || (g != lut->white[1]) ||
+                     (b != lut->white[2]))) {
+    lut->white[0] = r;
+    lut->white[1] = g;
+    lut->white[2] = b;
+    lut->stale = true;
+    markDirty();
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set overall brightness applied by show() as part of color
+            correction, after gamma and white balance. Buffer contents
+            are not changed, so there's no need to redraw anything, and
+            repeating the current value does nothing. Takes effect on the
+            next show().
+    @param  b  Brightness, 0 (off) to 255 (default, full).
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_buffered::setLUTBrightness(uint8_t b) {
+  if (allocLUT() && (b != lut->bright)) {
+    lut->bright = b;
+    lut->stale = true;
+    markDirty();
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Turn off show-time color correction and free its tables;
+            show() then sends the LED buffer as-is. Gamma, white balance
+            and brightness return to their defaults.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_buffered::clearColorCorrection(void) {
+  if (lut) {
+    free(lut);
+    lut = NULL;
+    markDirty();
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief    Allocate color correction tables if not already, with
+              default settings (no change to LED values) and the LED
+              channel map filled in. A new allocation marks all LEDs as
+              changed.
+    @returns  true if tables are allocated, false if out of memory.
+*/
+/**************************************************************************/
+bool Adafruit_IS31FL3741_buffered::allocLUT(void) {
+  if (!lut) {
+    if (!(lut = (IS3741_lut *)malloc(sizeof(IS3741_lut))))
+      return false;
+    // Channel map doesn't change with settings, so it's made just once
+    memset(lut->map, 0, sizeof lut->map);
+    for (uint16_t led = 0; led < 351; led++)
+      lut->map[led >> 2] |= ledChannel(led) << ((led & 3) * 2);
+    for (uint8_t c = 0; c < 3; c++) {
+      lut->gamma[c] = 1.0;
+      lut->white[c] = 255;
     }
-    page_bytes = 171; // Subsequent page is smaller
+    lut->bright = 255;
+    updateGamma();
+    lut->stale = true;
+    markDirty();
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Recompute the gamma curves (without white balance or
+            brightness) from the current exponents. Uses pow(), so this
+            is only done when they change. Tables must be allocated.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_buffered::updateGamma(void) {
+  for (uint8_t c = 0; c < 3; c++) {
+    uint8_t *curve = lut->curve[c];
+    if (c && (lut->gamma[c] == lut->gamma[c - 1])) {
+      memcpy(curve, lut->curve[c - 1], 256); // pow() is slow, reuse prior
+    } else {
+      for (uint16_t i = 0; i < 256; i++) {
+        float x = i / 255.0;
+        if (lut->gamma[c] != 1.0)
+          x = pow(x, lut->gamma[c]);
+        curve[i] = (uint8_t)(x * 255.0 + 0.5);
+      }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief    Rebuild color correction tables if settings changed; called
+              by show() and showAsync(), not directly.
+    @returns  true if color correction is enabled and tables are ready,
+              false if disabled (LED values are then sent uncorrected).
+*/
+/**************************************************************************/
+bool Adafruit_IS31FL3741_buffered::updateLUT(void) {
+  if (!lut)
+    return false;
+  if (lut->stale) {
+    for (uint8_t c = 0; c < 3; c++) {
+      // Combined white balance and brightness, 16-bit fixed point where
+      // 65536 is 1.0, then applied to the gamma curve with a multiply
+      uint32_t scale =
+          ((uint32_t)lut->white[c] * lut->bright * 65536 + 32512) / 65025;
+      const uint8_t *curve = lut->curve[c];
+      uint8_t *table = lut->table[c];
+      for (uint16_t i = 0; i < 256; i++)
+        table[i] = (curve[i] * scale + 32768) >> 16;
+    }
+    lut->stale = false;
   }
+  return true;
+}
+
+// Power model. Sums of PWM values are kept for 11 blocks of 32 LEDs, and
+// show() re-sums only blocks with changed LEDs (4 bytes of the dirty[]
+// mask each), so the total is current without rescanning every frame.
+// This state (IS3741_power) is allocated only while the model is enabled.
+
+/**************************************************************************/
+/*!
+    @brief  Enable power model, which estimates total LED current from
+            PWM values (after any color correction), LED scaling (if all
+            LEDs are set the same, e.g. setLEDscaling(0xFF) or
+            setBrightness(); otherwise full scaling is assumed) and global
+            current. If the estimate exceeds a limit, show() lowers the
+            global current written to the device, restoring the requested
+            setGlobalCurrent() level once the frame allows it. Handy for
+            battery-powered projects that brown out on bright frames.
+            Enabling the model allocates 36 bytes; if that fails, the
+            model stays off.
+    @param  milliamps     Maximum total LED current, or 0 for no limit
+                          (getEstimatedCurrent() still works).
+    @param  ledMilliamps  Current of one LED at full PWM, scaling and
+                          global current, which depends on the board.
+                          Default is IS3741_LED_MA. 0 turns off the power
+                          model and frees its state.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_buffered::setPowerLimit(uint16_t milliamps,
+                                                 float ledMilliamps) {
+  if (!ledMilliamps) { // Model off; lift limit and restore global current
+    free(power);
+    power = NULL;
+    _gccCap = 255;
+    if ((_gcc >= 0) && (_gcc != _gccOut))
+      writeGlobalCurrent(_gcc);
+    return;
+  }
+  if (!power) {
+    if (!(power = (IS3741_power *)malloc(sizeof(IS3741_power))))
+      return;
+    power->estimate = 0;
+    power->stale = 0x7FF; // Sum all blocks on next show()
+    power->gccPending = -1;
+  }
+  power->ledMilliamps = ledMilliamps;
+  power->limit = milliamps;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Update power model for changed LEDs and work out the global
+              current to use; called by show() and showAsync(), not
+              directly.
+    @param    correct  true if LED values are passed through color
+                       correction tables on their way out.
+    @returns  Global current to write (at most that last requested with
+              setGlobalCurrent()), or -1 if power model is off or the
+              requested level isn't known.
+*/
+/**************************************************************************/
+int16_t Adafruit_IS31FL3741_buffered::updatePower(bool correct) {
+  if (!power)
+    return -1;
+
+  uint32_t total = 0;
+  for (uint8_t blk = 0; blk < 11; blk++) {
+    const uint8_t *m = &dirty[blk * 4]; // 32 LEDs per block
+    if ((power->stale & (1 << blk)) || m[0] || m[1] || m[2] || m[3]) {
+      uint16_t led = blk * 32, end = min(led + 32, 351), sum = 0;
+      for (; led < end; led++)
+        sum += correct ? lutValue(led, ledbuf[led + 1]) : ledbuf[led + 1];
+      power->blockSum[blk] = sum;
+    }
+    total += power->blockSum[blk];
+  }
+  power->stale = 0;
+
+  // Estimated milliamps at full global current
+  float full = total * ((_scale >= 0) ? _scale : 255) * power->ledMilliamps /
+               (255.0 * 255.0);
+  _gccCap = (power->limit && (full > power->limit))
+                ? (uint8_t)(power->limit * 255.0 / full)
+                : 255;
+  if (_gcc < 0) { // Requested level unknown, leave it be, assume the worst
+    power->estimate = full;
+    return -1;
+  }
+  uint8_t gcc = min((int)_gcc, (int)_gccCap);
+  power->estimate = full * gcc / 255.0;
+  return gcc;
 }
 
 // INTERMEDIARY CLASSES FOR COLORS AND GFX ---------------------------------
@@ -515,7 +1155,9 @@ Adafruit_IS31FL3741_colorGFX::Adafruit_IS31FL3741_colorGFX(uint8_t width,
                                                            uint8_t height,
                                                            IS3741_order order)
     : Adafruit_IS31FL3741(), Adafruit_IS31FL3741_ColorOrder(order),
-      Adafruit_GFX(width, height) {}
+      Adafruit_GFX(width, height) {
+  setBatchQueue(batchQueue, IS3741_BATCH_SIZE);
+}
 
 /**************************************************************************/
 /*!
@@ -526,12 +1168,14 @@ Adafruit_IS31FL3741_colorGFX::Adafruit_IS31FL3741_colorGFX(uint8_t width,
 /**************************************************************************/
 void Adafruit_IS31FL3741_colorGFX::fill(uint16_t color) {
   // Fill must be done pixel-by-pixel due to different mappings & offsets
-  // for each matrix type.
+  // for each matrix type. Batching merges adjacent LEDs into larger writes.
+  beginBatch();
   for (uint8_t y = 0; y < height(); y++) {
     for (uint8_t x = 0; x < width(); x++) {
       drawPixel(x, y, color);
     }
   }
+  endBatch();
 }
 
 /**************************************************************************/
@@ -553,13 +1197,15 @@ Adafruit_IS31FL3741_colorGFX_buffered::Adafruit_IS31FL3741_colorGFX_buffered(
 */
 /**************************************************************************/
 void Adafruit_IS31FL3741_colorGFX_buffered::fill(uint16_t color) {
-  // If high and low bytes of color are the same...
-  if ((color >> 8) == (color & 0xFF)) {
+  // If black or white (all LEDs full off or full on)...
+  if ((color == 0) || (color == 0xFFFF)) {
     // Can just memset the whole pixel buffer to that byte
     memset(&ledbuf[1], color & 0xFF, 351);
+    markDirty();
   } else {
     // Otherwise, fill must be done pixel-by-pixel due to
     // different mappings & offsets in parts of the matrix.
+    // drawPixel() flags the changed LEDs.
     for (uint8_t y = 0; y < height(); y++) {
       for (uint8_t x = 0; x < width(); x++) {
         drawPixel(x, y, color);
@@ -568,162 +1214,326 @@ void Adafruit_IS31FL3741_colorGFX_buffered::fill(uint16_t color) {
   }
 }
 
-// DEVICE-SPECIFIC SUBCLASSES ----------------------------------------------
-
-// LUMISSIL EVAL BOARD (DIRECT, UNBUFFERED) --------------------------------
+// SUPERSAMPLED SCALING ---------------------------------------------------
 
 /**************************************************************************/
 /*!
-    @brief  Adafruit GFX low level accessor - sets an RGB pixel value,
-            handles rotation and pixel arrangement.
-    @param  x      The x position, starting with 0 for left-most side
-    @param  y      The y position, starting with 0 for top-most side
-    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+    @brief    Allocate scaler tables and compute filter weights, gamma table
+              and normalization; used by begin(), not directly. LED
+              indices are then filled in by begin().
+    @param    width   Matrix width in pixels.
+    @param    height  Matrix height in pixels.
+    @param    ratio   Canvas pixels per matrix pixel, 2 to 4.
+    @param    kernel  IS3741_BOX or IS3741_TENT.
+    @param    gamma   Gamma correction exponent.
+    @returns  true on success, false if ratio is out of range or memory
+              could not be allocated.
 */
 /**************************************************************************/
-void Adafruit_IS31FL3741_EVB::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
-    _IS31_ROTATE_(x, y);           // Handle GFX-style soft rotation
-    _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
-
-    // Map x/y to device-specific pixel layout
-    uint16_t offset = ((y > 2) ? (x * 10 + 12 - y) : (92 + x * 3 - y)) * 3;
+bool Adafruit_IS31FL3741_Scaler::alloc(uint8_t width, uint8_t height,
+                                       uint8_t ratio, IS3741_kernel kernel,
+                                       float gamma) {
+  free(targets);
+  targets = NULL;
+  this->width = this->height = 0; // scale() does nothing unless all's well
+  if ((ratio < 2) || (ratio > 4))
+    return false;
+  uint16_t n = width * height * 3; // R,G,B LED index per pixel
+  if (!(targets = (uint16_t *)malloc(n * sizeof(uint16_t) + 256)))
+    return false;
+  gammaTable = (uint8_t *)&targets[n];
+  this->width = width;
+  this->height = height;
+  this->ratio = ratio;
+
+  // Filter weights are the same along each axis. Box is 1 for each of a
+  // pixel's own 'ratio' canvas pixels. Tent peaks at the block center and
+  // falls off linearly to 0 at the centers of neighboring blocks, so it
+  // also takes in some of those (in integers, this is doubled).
+  taps = 0;
+  for (int8_t d = -ratio; d < ratio * 2; d++) {
+    int8_t w = (kernel == IS3741_TENT) ? ratio * 2 - abs(d * 2 + 1 - ratio)
+                                       : ((d >= 0) && (d < ratio));
+    if (w > 0) {
+      if (!taps)
+        first = d;
+      weight[taps++] = w;
+    }
+  }
+  uint8_t odd = 0, sum = 0;
+  for (uint8_t i = 0; i < taps; i++)
+    odd |= weight[i];
+  for (uint8_t i = 0; i < taps; i++) {
+    if (!(odd & 1)) // All even? Halve for smaller sums
+      weight[i] >>= 1;
+    sum += weight[i];
+  }
 
-    /*
-    Serial.print("("); Serial.print(x);
-    Serial.print(", "); Serial.print(y);
-    Serial.print(") -> "); Serial.println(offset);
-    */
+  // Weighted sums of 5- or 6-bit canvas values are scaled to 8 bits by
+  // 16.16 fixed-point multiply, then gamma-corrected by table.
+  uint32_t total = (uint32_t)sum * sum;
+  multRB = (255UL * 65536 + total * 31 / 2) / (total * 31);
+  multG = (255UL * 65536 + total * 63 / 2) / (total * 63);
+  for (uint16_t i = 0; i < 256; i++)
+    gammaTable[i] = (uint8_t)(pow(i / 255.0, gamma) * 255.0 + 0.5);
+  return true;
+}
 
-    setLEDPWM(offset + rOffset, r);
-    setLEDPWM(offset + gOffset, g);
-    setLEDPWM(offset + bOffset, b);
+/**************************************************************************/
+/*!
+    @brief  Filter one matrix pixel's worth of canvas; used by scale(),
+            not directly. Canvas pixels beyond the edges (for the tent
+            filter) repeat the edge pixels.
+    @param  canvas  Canvas, already checked to be the right size.
+    @param  x       Matrix column.
+    @param  y       Matrix row.
+    @param  rgb     Gamma-corrected red, green and blue, 0 to 255
+                    (returned).
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_Scaler::sample(const GFXcanvas16 *canvas, uint8_t x,
+                                        uint8_t y, uint8_t *rgb) const {
+  const uint16_t *src = canvas->getBuffer();
+  int16_t cw = canvas->width(), ch = canvas->height();
+  uint32_t rsum = 0, gsum = 0, bsum = 0;
+  int16_t sy = y * ratio + first;
+  for (uint8_t j = 0; j < taps; j++, sy++) {
+    const uint16_t *row = &src[min(max((int)sy, 0), ch - 1) * cw];
+    uint16_t r = 0, g = 0, b = 0; // One row's weighted sums
+    int16_t sx = x * ratio + first;
+    for (uint8_t i = 0; i < taps; i++, sx++) {
+      uint16_t c = row[min(max((int)sx, 0), cw - 1)];
+      r += (c >> 11) * weight[i];         // 5 bits red,
+      g += ((c >> 5) & 0x3F) * weight[i]; // 6 bits green,
+      b += (c & 0x1F) * weight[i];        // 5 bits blue
+    }
+    rsum += (uint32_t)r * weight[j];
+    gsum += (uint32_t)g * weight[j];
+    bsum += (uint32_t)b * weight[j];
   }
+  rgb[0] = gammaTable[min((int)((rsum * multRB + 32768) >> 16), 255)];
+  rgb[1] = gammaTable[min((int)((gsum * multG + 32768) >> 16), 255)];
+  rgb[2] = gammaTable[min((int)((bsum * multRB + 32768) >> 16), 255)];
 }
 
-// LUMISSIL EVAL BOARD (BUFFERED) ------------------------------------------
-
 /**************************************************************************/
 /*!
-    @brief  Adafruit GFX low level accessor - sets an RGB pixel value,
-            handles rotation and pixel arrangement.
-    @param  x      The x position, starting with 0 for left-most side
-    @param  y      The y position, starting with 0 for top-most side
-    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+    @brief  Downsample canvas to a direct (unbuffered) matrix, writing all
+            of its pixels. As with Adafruit_EyeLights::scale(), this
+            overwrites every matrix pixel, including any shared with
+            other things (e.g. EyeLights rings). Does nothing if begin()
+            failed or the canvas isn't 'ratio' times the matrix size.
+    @param  canvas  Pointer to source GFXcanvas16.
+    @param  matrix  Matrix object whose layout was passed to begin().
 */
 /**************************************************************************/
-void Adafruit_IS31FL3741_EVB_buffered::drawPixel(int16_t x, int16_t y,
-                                                 uint16_t color) {
-  if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
-    _IS31_ROTATE_(x, y);           // Handle GFX-style soft rotation
-    _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
-
-    // Map x/y to device-specific pixel layout
-    uint16_t offset = ((y > 2) ? (x * 10 + 12 - y) : (92 + x * 3 - y)) * 3;
-
-    /*
-    Serial.print("("); Serial.print(x);
-    Serial.print(", "); Serial.print(y);
-    Serial.print(") -> "); Serial.println(offset);
-    */
+void Adafruit_IS31FL3741_Scaler::scale(const GFXcanvas16 *canvas,
+                                       Adafruit_IS31FL3741 &matrix) {
+  if (!canvas || !width || (canvas->width() != width * ratio) ||
+      (canvas->height() != height * ratio))
+    return;
+  const uint16_t *t = targets;
+  matrix.beginBatch();
+  for (uint8_t y = 0; y < height; y++) {
+    for (uint8_t x = 0; x < width; x++, t += 3) {
+      if (t[0] != 65535) { // Skip unmapped pixels
+        uint8_t rgb[3];
+        sample(canvas, x, y, rgb);
+        matrix.setLEDPWM(t[0], rgb[0]);
+        matrix.setLEDPWM(t[1], rgb[1]);
+        matrix.setLEDPWM(t[2], rgb[2]);
+      }
+    }
+  }
+  matrix.endBatch();
+}
 
-    uint8_t *ptr = &ledbuf[1 + offset];
-    ptr[rOffset] = r;
-    ptr[gOffset] = g;
-    ptr[bOffset] = b;
+/**************************************************************************/
+/*!
+    @brief  Downsample canvas to a buffered matrix, as above. No immediate
+            effect on LEDs; must follow up with show().
+    @param  canvas  Pointer to source GFXcanvas16.
+    @param  matrix  Matrix object whose layout was passed to begin().
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_Scaler::scale(const GFXcanvas16 *canvas,
+                                       Adafruit_IS31FL3741_buffered &matrix) {
+  if (!canvas || !width || (canvas->width() != width * ratio) ||
+      (canvas->height() != height * ratio))
+    return;
+  const uint16_t *t = targets;
+  uint8_t *ledbuf = &matrix.ledbuf[1]; // Not getBuffer(), that flags ALL
+  for (uint8_t y = 0; y < height; y++) {
+    for (uint8_t x = 0; x < width; x++, t += 3) {
+      if (t[0] != 65535) { // Skip unmapped pixels
+        uint8_t rgb[3];
+        sample(canvas, x, y, rgb);
+        for (uint8_t c = 0; c < 3; c++) {
+          ledbuf[t[c]] = rgb[c];
+          matrix.markDirty(t[c]);
+        }
+      }
+    }
   }
 }
 
-// STEMMA QT MATRIX (DIRECT) -----------------------------------------------
+// CHANGE-TRACKING CANVAS --------------------------------------------------
 
 /**************************************************************************/
 /*!
-    @brief  Adafruit GFX low level accessor - sets an RGB pixel value,
-            handles rotation and pixel arrangement.
-    @param  x      The x position, starting with 0 for left-most side.
-    @param  y      The y position, starting with 0 for top-most side.
-    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+    @brief  Constructor for change-tracking canvas. All blocks start out
+            flagged as changed, so the first scale() processes everything.
+    @param  w  Canvas width in pixels, normally 3X the matrix width.
+    @param  h  Canvas height in pixels, normally 3X the matrix height.
 */
 /**************************************************************************/
-void Adafruit_IS31FL3741_QT::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
-    _IS31_ROTATE_(x, y);           // Handle GFX-style soft rotation
-    _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
-
-    /*
-    Serial.print("("); Serial.print(x);
-    Serial.print(", "); Serial.print(y);
-    Serial.print(") -> 0x");
-    */
+Adafruit_IS31FL3741_TrackedCanvas::Adafruit_IS31FL3741_TrackedCanvas(
+    uint16_t w, uint16_t h)
+    : GFXcanvas16(w, h), cols((w + 2) / 3), rows((h + 2) / 3) {
+  blocks = new uint8_t[(cols * rows + 7) / 8];
+  markDirty();
+}
 
-    // Remap the row (y)
-    static const uint8_t rowmap[] = {8, 5, 4, 3, 2, 1, 0, 7, 6};
-    y = rowmap[y];
-
-    uint16_t offset = (x + ((x < 10) ? (y * 10) : (80 + y * 3))) * 3;
-    // Serial.println(offset, HEX);
-
-    if ((x & 1) || (x == 12)) { // Odd columns + last column
-      // Rearrange color order vs constructor. Not a simple swap,
-      // needs to pass through table, or essentially (n + 2) % 3.
-      static const uint8_t remap[] = {2, 0, 1};
-      setLEDPWM(offset + remap[rOffset], r);
-      setLEDPWM(offset + remap[gOffset], g);
-      setLEDPWM(offset + remap[bOffset], b);
-    } else {                          // Even columns
-      setLEDPWM(offset + rOffset, r); // Color order follows constructor
-      setLEDPWM(offset + gOffset, g);
-      setLEDPWM(offset + bOffset, b);
+/**************************************************************************/
+/*!
+    @brief  Flag a rectangle of the canvas as changed. Drawing functions
+            call this automatically; user code only needs it after writing
+            to getBuffer() directly, where markDirty(void) would be
+            overkill.
+    @param  x  Left edge, in current rotation's coordinates.
+    @param  y  Top edge, in current rotation's coordinates.
+    @param  w  Width in pixels; negative extends left from x.
+    @param  h  Height in pixels; negative extends up from y.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_TrackedCanvas::markDirty(int16_t x, int16_t y,
+                                                  int16_t w, int16_t h) {
+  if (!blocks || !w || !h)
+    return;
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  // Opposite corners, rotated to buffer coordinates as GFXcanvas16 does
+  int32_t cx[2] = {x, (int32_t)x + w - 1}, cy[2] = {y, (int32_t)y + h - 1};
+  for (uint8_t i = 0; i < 2; i++) {
+    int32_t t = cx[i];
+    switch (getRotation()) {
+    case 1:
+      cx[i] = WIDTH - 1 - cy[i];
+      cy[i] = t;
+      break;
+    case 2:
+      cx[i] = WIDTH - 1 - t;
+      cy[i] = HEIGHT - 1 - cy[i];
+      break;
+    case 3:
+      cx[i] = cy[i];
+      cy[i] = HEIGHT - 1 - t;
+      break;
+    }
+  }
+  // Clip to canvas, then flag every block the rectangle touches
+  int32_t x0 = max(min(cx[0], cx[1]), (int32_t)0);
+  int32_t y0 = max(min(cy[0], cy[1]), (int32_t)0);
+  int32_t x1 = min(max(cx[0], cx[1]), (int32_t)WIDTH - 1);
+  int32_t y1 = min(max(cy[0], cy[1]), (int32_t)HEIGHT - 1);
+  for (int32_t by = y0 / 3; by <= y1 / 3; by++) {
+    for (int32_t bx = x0 / 3; bx <= x1 / 3; bx++) {
+      uint16_t n = by * cols + bx;
+      blocks[n / 8] |= 1 << (n & 7);
     }
   }
 }
 
-// STEMMA QT MATRIX (BUFFERED) ---------------------------------------------
+/**************************************************************************/
+/*!
+    @brief  Draw a pixel to the canvas and flag its block as changed.
+    @param  x      Horizontal pixel position.
+    @param  y      Vertical pixel position.
+    @param  color  16-bit RGB565 color.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_TrackedCanvas::drawPixel(int16_t x, int16_t y,
+                                                  uint16_t color) {
+  GFXcanvas16::drawPixel(x, y, color);
+  markDirty(x, y, 1, 1);
+}
 
 /**************************************************************************/
 /*!
-    @brief         Adafruit GFX low level accessor - sets an RGB pixel value,
-                   handles rotation and pixel arrangement, unlike setLEDPWM.
-    @param  x      The x position, starting with 0 for left-most side
-    @param  y      The y position, starting with 0 for top-most side
-    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+    @brief  Fill the whole canvas and flag all blocks as changed.
+    @param  color  16-bit RGB565 color.
 */
 /**************************************************************************/
-void Adafruit_IS31FL3741_QT_buffered::drawPixel(int16_t x, int16_t y,
-                                                uint16_t color) {
-  if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
-    _IS31_ROTATE_(x, y);           // Handle GFX-style soft rotation
-    _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
+void Adafruit_IS31FL3741_TrackedCanvas::fillScreen(uint16_t color) {
+  GFXcanvas16::fillScreen(color);
+  markDirty();
+}
 
-    /*
-    Serial.print("("); Serial.print(x);
-    Serial.print(", "); Serial.print(y);
-    Serial.print(") -> 0x");
-    */
+/**************************************************************************/
+/*!
+    @brief  Draw a vertical line and flag the blocks it crosses.
+    @param  x      Horizontal position of line.
+    @param  y      Top of line.
+    @param  h      Length of line in pixels.
+    @param  color  16-bit RGB565 color.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_TrackedCanvas::drawFastVLine(int16_t x, int16_t y,
+                                                      int16_t h,
+                                                      uint16_t color) {
+  GFXcanvas16::drawFastVLine(x, y, h, color);
+  markDirty(x, y, 1, h);
+}
 
-    // Remap the row (y)
-    static const uint8_t rowmap[] = {8, 5, 4, 3, 2, 1, 0, 7, 6};
-    y = rowmap[y];
-
-    uint16_t offset = (x + ((x < 10) ? (y * 10) : (80 + y * 3))) * 3;
-    // Serial.println(offset, HEX);
-
-    uint8_t *ptr = &ledbuf[1 + offset];
-    if ((x & 1) || (x == 12)) { // Odd columns + last column
-      // Rearrange color order vs constructor. Not a simple swap,
-      // needs to pass through table, or essentially (n + 2) % 3.
-      static const uint8_t remap[] = {2, 0, 1};
-      ptr[remap[rOffset]] = r;
-      ptr[remap[gOffset]] = g;
-      ptr[remap[bOffset]] = b;
-    } else {            // Even columns
-      ptr[rOffset] = r; // Color order follows constructor
-      ptr[gOffset] = g;
-      ptr[bOffset] = b;
-    }
-  }
+/**************************************************************************/
+/*!
+    @brief  Draw a horizontal line and flag the blocks it crosses.
+    @param  x      Left edge of line.
+    @param  y      Vertical position of line.
+    @param  w      Length of line in pixels.
+    @param  color  16-bit RGB565 color.
+*/
+/**************************************************************************/
+void Adafruit_IS31FL3741_TrackedCanvas::drawFastHLine(int16_t x, int16_t y,
+                                                      int16_t w,
+                                                      uint16_t color) {
+  GFXcanvas16::drawFastHLine(x, y, w, color);
+  markDirty(x, y, w, 1);
 }
 
+// DEVICE-SPECIFIC SUBCLASSES ----------------------------------------------
+// drawPixel() for the EVB and QT boards, direct and buffered, is in the
+// Matrix class templates in the header, with layout structs providing the
+// board-specific mapping. Only the layouts' slotmap tables are here.
+// These are generated from the led() functions: 2 bits per LED, four LEDs
+// per byte (first LED in least significant bits).
+
+const uint8_t PROGMEM IS3741_EVB_layout::slotmap[88] = {
+    0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92,
+    0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92,
+    0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92,
+    0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92,
+    0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92,
+    0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92,
+    0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92,
+    0x24, 0x49, 0x92, 0xE4};
+
+const uint8_t PROGMEM IS3741_QT_layout::slotmap[88] = {
+    0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26,
+    0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26,
+    0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26,
+    0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26,
+    0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26,
+    0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x64, 0x42, 0x26, 0x09, 0x99, 0x24,
+    0x64, 0x92, 0x90, 0x49, 0x42, 0x26, 0x09, 0x99, 0x24, 0x64, 0x92, 0x90,
+    0x49, 0x42, 0x26, 0xC9};
+
 // LED GLASSES -------------------------------------------------------------
 // There are two implementations of this. First here are the EyeLights
 // classes (direct and buffered versions), which are a little simpler to
@@ -737,7 +1547,7 @@ void Adafruit_IS31FL3741_QT_buffered::drawPixel(int16_t x, int16_t y,
 // they originally shipped, hence default IS3741_BGR order in constructor,
 // to match the QT matrix LEDs. If there's a switch to different LEDs in
 // the future, pass a different order to the constructor.
-static const uint16_t PROGMEM glassesmatrix_ledmap[18 * 5 * 3] = {
+const uint16_t PROGMEM glassesmatrix_ledmap[18 * 5 * 3] = {
     65535, 65535, 65535, // (0,0) (clipped, corner)
     10,    8,     9,     // (0,1) / right ring pixel 20
     13,    11,    12,    // (0,2) / 19
@@ -830,6 +1640,17 @@ static const uint16_t PROGMEM glassesmatrix_ledmap[18 * 5 * 3] = {
     276,   22,    277,   // (17,4) / 7
 };
 
+// slot() table for EyeLights layout, as with EVB and QT above.
+const uint8_t PROGMEM IS3741_EyeLights_layout::slotmap[88] = {
+    0x9F, 0xFC, 0x49, 0x92, 0xFC, 0x1F, 0x36, 0xF6, 0x49, 0x92, 0x24, 0xC9,
+    0xFF, 0x61, 0x63, 0x9F, 0x24, 0x49, 0x92, 0xFC, 0x1F, 0x36, 0xF6, 0x49,
+    0x92, 0x24, 0xC9, 0xFF, 0x61, 0x63, 0x9F, 0x24, 0x49, 0x92, 0xFC, 0x1F,
+    0x36, 0xF6, 0x7F, 0x92, 0x24, 0xC9, 0xFF, 0x61, 0x63, 0x9F, 0x24, 0x49,
+    0x92, 0xFC, 0x1F, 0x36, 0xF6, 0x49, 0x92, 0x24, 0xC9, 0xFF, 0x63, 0x63,
+    0x9F, 0x24, 0x49, 0x92, 0xFC, 0x1F, 0x36, 0x86, 0xFD, 0x38, 0x86, 0xE1,
+    0x18, 0x86, 0x63, 0x18, 0x8E, 0x61, 0x38, 0x86, 0xE1, 0x18, 0x86, 0x63,
+    0xD8, 0x8F, 0x61, 0xF8};
+
 // Remap tables for LED ring pixel positions to LED indices, for
 // setPixelColor() functions.
 static const uint16_t PROGMEM left_ring_map[24 * 3] = {
@@ -885,6 +1706,21 @@ static const uint16_t PROGMEM right_ring_map[24 * 3] = {
     296, 60,  61,  // 23
 };
 
+// Find an LED in the ring tables and return its color (0-2 = R,G,B, or 3
+// if not a ring LED), for the EyeLights classes' ledChannel(). Slow-ish,
+// but that's only called when color correction tables are allocated.
+static uint8_t ringChannel(uint16_t led,
+                           const Adafruit_IS31FL3741_ColorOrder *order) {
+  for (uint8_t i = 0; i < 24 * 3; i++) {
+    if ((pgm_read_word(&left_ring_map[i]) == led) ||
+        (pgm_read_word(&right_ring_map[i]) == led)) {
+      uint8_t s = i % 3; // Element of ring pixel's RGB triplet
+      return (s == order->rOffset) ? 0 : (s == order->gOffset) ? 1 : 2;
+    }
+  }
+  return 3;
+}
+
 // GFXcanvas16 is RGB565 color while the LEDs are RGB888, so during 1:3
 // downsampling we recover some intermediate shades and apply gamma
 // correction for better linearity. Tables are used to avoid floating-point
@@ -953,22 +1789,227 @@ static const uint8_t PROGMEM gammaG[] = {
     225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 236, 237, 238, 239, 240,
     241, 242, 243, 245, 246, 247, 248, 249, 250, 252, 253, 254, 255};
 
+// Spread an RGB565 color so that red, green and blue can be summed in
+// separate fields of one 32-bit word: blue in bits 0-8, red 11-19, green
+// 21-30. Nine pixels (one 3x3 block) can't overflow any field.
+static inline uint32_t spread565(uint16_t c) {
+  return (c & 0xF81F) | ((uint32_t)(c & 0x07E0) << 16);
+}
+
+// Gamma-correct a spread 3x3 sum, returning red in bits 0-7, green 8-15,
+// blue 16-23.
+static uint32_t gammaPack(uint32_t sum) {
+  return pgm_read_byte(&gammaRB[(sum >> 11) & 0x1FF]) |
+         ((uint32_t)pgm_read_byte(&gammaG[sum >> 21]) << 8) |
+         ((uint32_t)pgm_read_byte(&gammaRB[sum & 0x1FF]) << 16);
+}
+
+/**************************************************************************/
+/*!
+    @brief    Check that a canvas is 3X the size of a matrix (in the
+              canvas' unrotated orientation), for the scale() functions.
+    @param    canvas  Pointer to canvas.
+    @param    cols    Matrix width in pixels.
+    @param    rows    Matrix height in pixels.
+    @returns  true if canvas size matches, else false.
+*/
+/**************************************************************************/
+bool IS3741_downsample::canvasFits(const Adafruit_GFX *canvas, uint8_t cols,
+                                   uint8_t rows) {
+  bool swap = canvas->getRotation() & 1;
+  int16_t w = swap ? canvas->height() : canvas->width();
+  int16_t h = swap ? canvas->width() : canvas->height();
+  return (w == cols * 3) && (h == rows * 3);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Average one row of 3x3 blocks of a 16-bit canvas and
+            gamma-correct the results, for the 1:3 antialiased scale()
+            functions. Canvas is read in memory order, with the three
+            RGB565 components of each pixel summed at once in one word.
+    @param  canvas  Pointer to canvas, 3X matrix size.
+    @param  unused  Ignored; for symmetry with other canvas types.
+    @param  cols    Matrix width in pixels.
+    @param  y       Matrix row.
+    @param  x0      First matrix column to process.
+    @param  width   Number of matrix columns to process.
+    @param  acc     Pointer to 'width' words for results, each with
+                    gamma-corrected red in bits 0-7, green 8-15, blue 16-23.
+*/
+/**************************************************************************/
+void IS3741_downsample::scaleRow(const GFXcanvas16 *canvas,
+                                 const uint16_t *unused, uint8_t cols,
+                                 uint8_t y, uint8_t x0, uint8_t width,
+                                 uint32_t *acc) {
+  (void)unused;
+  uint16_t stride = cols * 3;
+  const uint16_t *src = &canvas->getBuffer()[(y * stride + x0) * 3];
+  memset(acc, 0, width * sizeof(uint32_t));
+  for (uint8_t yy = 0; yy < 3; yy++) {
+    for (uint8_t x = 0; x < width; x++) {
+      uint32_t sum = acc[x];
+      sum += spread565(*src++);
+      sum += spread565(*src++);
+      sum += spread565(*src++);
+      acc[x] = sum;
+    }
+    src += stride - width * 3; // Advance to next scan line
+  }
+  for (uint8_t x = 0; x < width; x++)
+    acc[x] = gammaPack(acc[x]);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Average one row of 3x3 blocks of an 8-bit palette-indexed
+            canvas and gamma-correct the results, for the 1:3 antialiased
+            scale() functions. Same as the 16-bit version, but each pixel
+            is looked up in a palette first.
+    @param  canvas   Pointer to canvas, 3X matrix size.
+    @param  palette  RGB565 color for each index used in the canvas.
+    @param  cols     Matrix width in pixels.
+    @param  y        Matrix row.
+    @param  x0       First matrix column to process.
+    @param  width    Number of matrix columns to process.
+    @param  acc      Pointer to 'width' words for results, each with
+                     gamma-corrected red in bits 0-7, green 8-15, blue
+                     16-23.
+*/
+/**************************************************************************/
+void IS3741_downsample::scaleRow(const GFXcanvas8 *canvas,
+                                 const uint16_t *palette, uint8_t cols,
+                                 uint8_t y, uint8_t x0, uint8_t width,
+                                 uint32_t *acc) {
+  uint16_t stride = cols * 3;
+  const uint8_t *src = &canvas->getBuffer()[(y * stride + x0) * 3];
+  memset(acc, 0, width * sizeof(uint32_t));
+  for (uint8_t yy = 0; yy < 3; yy++) {
+    for (uint8_t x = 0; x < width; x++) {
+      uint32_t sum = acc[x];
+      sum += spread565(palette[*src++]);
+      sum += spread565(palette[*src++]);
+      sum += spread565(palette[*src++]);
+      acc[x] = sum;
+    }
+    src += stride - width * 3; // Advance to next scan line
+  }
+  for (uint8_t x = 0; x < width; x++)
+    acc[x] = gammaPack(acc[x]);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Average one row of 3x3 blocks of a 1-bit canvas, for the 1:3
+            antialiased scale() functions. There are only ten possible
+            results per block (0 to 9 bits set), so these are precomputed
+            by monoLevels() and the kernel just counts bits.
+    @param  canvas  Pointer to canvas, 3X matrix size.
+    @param  levels  Ten gamma-corrected colors from monoLevels().
+    @param  cols    Matrix width in pixels.
+    @param  y       Matrix row.
+    @param  x0      First matrix column to process.
+    @param  width   Number of matrix columns to process.
+    @param  acc     Pointer to 'width' words for results, each with
+                    gamma-corrected red in bits 0-7, green 8-15, blue 16-23.
+*/
+/**************************************************************************/
+void IS3741_downsample::scaleRow(const GFXcanvas1 *canvas,
+                                 const uint32_t *levels, uint8_t cols,
+                                 uint8_t y, uint8_t x0, uint8_t width,
+                                 uint32_t *acc) {
+  uint8_t stride = (cols * 3 + 7) / 8; // Bytes per scan line
+  const uint8_t *src = &canvas->getBuffer()[y * 3 * stride];
+  for (uint8_t x = 0; x < width; x++) {
+    uint8_t bit = (x0 + x) * 3, byte = bit / 8, count = 0;
+    const uint8_t *ptr = &src[byte];
+    for (uint8_t yy = 0; yy < 3; yy++) {
+      // 3 bits may straddle two bytes, MSB is leftmost pixel
+      uint16_t word = ptr[0] << 8;
+      if ((byte + 1) < stride)
+        word |= ptr[1];
+      uint8_t bits = (word >> (13 - (bit & 7))) & 7;
+      count += (0xE994 >> (bits * 2)) & 3; // Bits set in 3-bit value
+      ptr += stride;
+    }
+    acc[x] = levels[count];
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Precompute the ten colors a 3x3 block of a 1-bit canvas can
+            downsample to, for scale() with a GFXcanvas1.
+    @param  fg      RGB565 color for set bits.
+    @param  bg      RGB565 color for clear bits.
+    @param  levels  Pointer to 10 words for results, index is number of
+                    bits set, each with gamma-corrected red in bits 0-7,
+                    green 8-15, blue 16-23.
+*/
+/**************************************************************************/
+void IS3741_downsample::monoLevels(uint16_t fg, uint16_t bg,
+                                   uint32_t *levels) {
+  uint32_t f = spread565(fg), b = spread565(bg);
+  for (uint8_t n = 0; n <= 9; n++)
+    levels[n] = gammaPack(f * n + b * (9 - n));
+}
+
 /**************************************************************************/
 /*!
     @brief  Constructor for EyeLights LED ring. This is a base class used
             by both the direct and buffered variants. Not invoked by user
             code.
-    @param  parent   void* pointer to parent EyeLights object this is
-                     attached to (may be direct or buffered, hence void*
-                     rather than specific type).
+    @param  order    Color order of the parent EyeLights object this is
+                     attached to (may be direct or buffered, both have
+                     this). Only used if IS3741_RING_RAM is defined.
     @param  isRight  true if right ring, false if left.
     @note   Constructor is here in the .cpp instead of the .h because it
             references the static tables above.
 */
 /**************************************************************************/
-Adafruit_EyeLights_Ring_Base::Adafruit_EyeLights_Ring_Base(void *parent,
-                                                           bool isRight)
-    : parent(parent), ring_map(isRight ? right_ring_map : left_ring_map) {}
+Adafruit_EyeLights_Ring_Base::Adafruit_EyeLights_Ring_Base(
+    const Adafruit_IS31FL3741_ColorOrder *order, bool isRight) {
+#if defined(IS3741_RING_RAM)
+  right = isRight;
+  resolveOrder(*order);
+#else
+  (void)order;
+  ring_map = isRight ? right_ring_map : left_ring_map;
+#endif
+}
+
+#if defined(IS3741_RING_RAM)
+/**************************************************************************/
+/*!
+    @brief  Copy ring's LED indices to RAM, resolved for a color order, so
+            ringLEDs() is a plain RAM copy. Done at construction and again
+            by ringLEDs() if the parent's color order has changed since.
+    @param  order  Color order of the parent EyeLights object.
+*/
+/**************************************************************************/
+void Adafruit_EyeLights_Ring_Base::resolveOrder(
+    const Adafruit_IS31FL3741_ColorOrder &order) {
+  const uint16_t *map = right ? right_ring_map : left_ring_map;
+  for (uint8_t n = 0; n < 24 * 3; n += 3) {
+    ring_map[n] = pgm_read_word(&map[n + order.rOffset]);
+    ring_map[n + 1] = pgm_read_word(&map[n + order.gOffset]);
+    ring_map[n + 2] = pgm_read_word(&map[n + order.bOffset]);
+  }
+  ring_order = (order.rOffset << 4) | (order.gOffset << 2) | order.bOffset;
+}
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  Constructor for one of the EyeLights ring objects (direct,
+            unbuffered). Used internally by the library, not user code.
+    @param  parent   Pointer to parent Adafruit_EyeLights object.
+    @param  isRight  true = right ring, false = left ring.
+*/
+/**************************************************************************/
+Adafruit_EyeLights_Ring::Adafruit_EyeLights_Ring(Adafruit_EyeLights *parent,
+                                                 bool isRight)
+    : Adafruit_EyeLights_Ring_Base(parent, isRight), parent(parent) {}
 
 // EYELIGHTS (DIRECT, UNBUFFERED) ------------------------------------------
 
@@ -982,12 +2023,14 @@ Adafruit_EyeLights_Ring_Base::Adafruit_EyeLights_Ring_Base(void *parent,
 /**************************************************************************/
 void Adafruit_EyeLights_Ring::setPixelColor(int16_t n, uint32_t color) {
   if ((n >= 0) && (n < 24)) {
-    Adafruit_EyeLights *eyelights = (Adafruit_EyeLights *)parent;
     _IS31_SCALE_RGB_(color, r, g, b, _brightness);
-    n *= 3;
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->rOffset]), r);
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->gOffset]), g);
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->bOffset]), b);
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    parent->beginBatch();
+    parent->setLEDPWM(idx[0], r);
+    parent->setLEDPWM(idx[1], g);
+    parent->setLEDPWM(idx[2], b);
+    parent->endBatch();
   }
 }
 
@@ -1004,12 +2047,14 @@ void Adafruit_EyeLights_Ring::setPixelColor(int16_t n, uint32_t color) {
 void Adafruit_EyeLights_Ring::setPixelColor(int16_t n, uint8_t r, uint8_t g,
                                             uint8_t b) {
   if ((n >= 0) && (n < 24)) {
-    Adafruit_EyeLights *eyelights = (Adafruit_EyeLights *)parent;
     _IS31_SCALE_RGB_SEPARATE_(r, g, b, _brightness);
-    n *= 3;
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->rOffset]), r);
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->gOffset]), g);
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->bOffset]), b);
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    parent->beginBatch();
+    parent->setLEDPWM(idx[0], r);
+    parent->setLEDPWM(idx[1], g);
+    parent->setLEDPWM(idx[2], b);
+    parent->endBatch();
   }
 }
 
@@ -1021,13 +2066,16 @@ void Adafruit_EyeLights_Ring::setPixelColor(int16_t n, uint8_t r, uint8_t g,
 */
 /**************************************************************************/
 void Adafruit_EyeLights_Ring::fill(uint32_t color) {
-  Adafruit_EyeLights *eyelights = (Adafruit_EyeLights *)parent;
   _IS31_SCALE_RGB_(color, r, g, b, _brightness);
-  for (uint8_t n = 0; n < 24 * 3; n += 3) {
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->rOffset]), r);
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->gOffset]), g);
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->bOffset]), b);
+  parent->beginBatch();
+  for (uint8_t n = 0; n < 24; n++) {
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    parent->setLEDPWM(idx[0], r);
+    parent->setLEDPWM(idx[1], g);
+    parent->setLEDPWM(idx[2], b);
   }
+  parent->endBatch();
 }
 
 /**************************************************************************/
@@ -1040,39 +2088,80 @@ void Adafruit_EyeLights_Ring::fill(uint32_t color) {
 */
 /**************************************************************************/
 void Adafruit_EyeLights_Ring::fill(uint8_t r, uint8_t g, uint8_t b) {
-  Adafruit_EyeLights *eyelights = (Adafruit_EyeLights *)parent;
   _IS31_SCALE_RGB_SEPARATE_(r, g, b, _brightness);
-  for (uint8_t n = 0; n < 24 * 3; n += 3) {
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->rOffset]), r);
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->gOffset]), g);
-    eyelights->setLEDPWM(pgm_read_word(&ring_map[n + eyelights->bOffset]), b);
+  parent->beginBatch();
+  for (uint8_t n = 0; n < 24; n++) {
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    parent->setLEDPWM(idx[0], r);
+    parent->setLEDPWM(idx[1], g);
+    parent->setLEDPWM(idx[2], b);
   }
+  parent->endBatch();
 }
 
 /**************************************************************************/
 /*!
-    @brief         Adafruit GFX low level accessor - sets an RGB pixel value
-                   on direct (unbuffered) EyeLights LED matrix.
-    @param  x      The x position, starting with 0 for left-most side
-    @param  y      The y position, starting with 0 for top-most side
-    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+    @brief  Set multiple pixels of one direct (unbuffered) EyeLights ring,
+            from an array of packed RGB values. Brightness is applied
+            once per pixel in a single pass.
+    @param  colors  Array of RGB888 (24-bit) colors, a la NeoPixel.
+    @param  count   Number of colors in array (0-24, default 24).
+    @param  rotate  Ring pixel index (0-23) where colors[0] is placed,
+                    subsequent colors follow in index order, wrapping
+                    around. Spinning patterns can be drawn by changing
+                    this each frame rather than recomputing colors.
 */
 /**************************************************************************/
-void Adafruit_EyeLights::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
-    _IS31_ROTATE_(x, y);           // Handle GFX-style soft rotation
-    _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
-    x = (x * 5 + y) * 3;           // Starting index into the led table above
-                                   // table is brg
-    uint16_t ridx = pgm_read_word(&glassesmatrix_ledmap[x + rOffset]);
-    if (ridx != 65535) {
-      uint16_t gidx = pgm_read_word(&glassesmatrix_ledmap[x + gOffset]);
-      uint16_t bidx = pgm_read_word(&glassesmatrix_ledmap[x + bOffset]);
-      setLEDPWM(ridx, r);
-      setLEDPWM(gidx, g);
-      setLEDPWM(bidx, b);
-    }
+void Adafruit_EyeLights_Ring::setPixels(const uint32_t *colors, uint8_t count,
+                                        uint8_t rotate) {
+  if (count > 24)
+    count = 24;
+  uint8_t n = rotate % 24;
+  parent->beginBatch();
+  for (uint8_t i = 0; i < count; i++) {
+    _IS31_SCALE_RGB_(colors[i], r, g, b, _brightness);
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    parent->setLEDPWM(idx[0], r);
+    parent->setLEDPWM(idx[1], g);
+    parent->setLEDPWM(idx[2], b);
+    if (++n >= 24)
+      n = 0;
   }
+  parent->endBatch();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set multiple pixels of one direct (unbuffered) EyeLights ring,
+            from an array of separate R,G,B bytes. Brightness is applied
+            once per pixel in a single pass.
+    @param  rgb     Array of 8-bit R,G,B values, 3 bytes per pixel.
+    @param  count   Number of pixels in array (0-24, default 24).
+    @param  rotate  Ring pixel index (0-23) where the first pixel is placed,
+                    subsequent pixels follow in index order, wrapping
+                    around.
+*/
+/**************************************************************************/
+void Adafruit_EyeLights_Ring::setPixels(const uint8_t *rgb, uint8_t count,
+                                        uint8_t rotate) {
+  if (count > 24)
+    count = 24;
+  uint8_t n = rotate % 24;
+  parent->beginBatch();
+  for (uint8_t i = 0; i < count; i++, rgb += 3) {
+    uint8_t r = rgb[0], g = rgb[1], b = rgb[2];
+    _IS31_SCALE_RGB_SEPARATE_(r, g, b, _brightness);
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    parent->setLEDPWM(idx[0], r);
+    parent->setLEDPWM(idx[1], g);
+    parent->setLEDPWM(idx[2], b);
+    if (++n >= 24)
+      n = 0;
+  }
+  parent->endBatch();
 }
 
 /**************************************************************************/
@@ -1083,43 +2172,28 @@ void Adafruit_EyeLights::drawPixel(int16_t x, int16_t y, uint16_t color) {
             shared with the rings. This is different than using normal
             drawing operations directly to the low-resolution matrix,
             where these ops are "transparent" and empty pixels don't
-            overwrite the rings.
+            overwrite the rings. With a change-tracking canvas, only
+            pixels drawn to since the last call are overwritten.
 */
 /**************************************************************************/
 void Adafruit_EyeLights::scale(void) {
-  if (canvas) {
-    uint16_t *src = canvas->getBuffer();
-    // Outer x/y loops are column-major on purpose (less pointer math)
-    for (int x = 0; x < 18; x++) {
-      uint16_t *ptr = &src[x * 3]; // Entry along top scan line w/x offset
-      for (int y = 0; y < 5; y++) {
-        uint16_t rsum = 0, gsum = 0, bsum = 0;
-        // Inner x/y loops are row-major on purpose (less pointer math)
-        for (uint8_t yy = 0; yy < 3; yy++) {
-          for (uint8_t xx = 0; xx < 3; xx++) {
-            uint16_t rgb = ptr[xx];
-            rsum += rgb >> 11;         // Accumulate 5 bits red,
-            gsum += (rgb >> 5) & 0x3F; // 6 bits green,
-            bsum += rgb & 0x1F;        // 5 bits blue
-          }
-          ptr += canvas->width(); // Advance one scan line
-        }
-        uint16_t base = (x * 5 + y) * 3; // Offset into ledmap
-        uint16_t ridx = pgm_read_word(&glassesmatrix_ledmap[base + rOffset]);
-        if (ridx != 65535) {
-          uint16_t gidx = pgm_read_word(&glassesmatrix_ledmap[base + gOffset]);
-          uint16_t bidx = pgm_read_word(&glassesmatrix_ledmap[base + bOffset]);
-          setLEDPWM(ridx, pgm_read_byte(&gammaRB[rsum]));
-          setLEDPWM(gidx, pgm_read_byte(&gammaG[gsum]));
-          setLEDPWM(bidx, pgm_read_byte(&gammaRB[bsum]));
-        }
-      }
-    }
-  }
+  scaleCanvas(canvas, ledMap(*this), tracked);
 }
 
 // EYELIGHTS (BUFFERED) ----------------------------------------------------
 
+/**************************************************************************/
+/*!
+    @brief  Constructor for one of the EyeLights ring objects (buffered).
+            Used internally by the library, not user code.
+    @param  parent   Pointer to parent Adafruit_EyeLights_buffered object.
+    @param  isRight  true = right ring, false = left ring.
+*/
+/**************************************************************************/
+Adafruit_EyeLights_Ring_buffered::Adafruit_EyeLights_Ring_buffered(
+    Adafruit_EyeLights_buffered *parent, bool isRight)
+    : Adafruit_EyeLights_Ring_Base(parent, isRight), parent(parent) {}
+
 /**************************************************************************/
 /*!
     @brief  Set color of one pixel of one buffered EyeLights ring, from a
@@ -1132,14 +2206,16 @@ void Adafruit_EyeLights::scale(void) {
 void Adafruit_EyeLights_Ring_buffered::setPixelColor(int16_t n,
                                                      uint32_t color) {
   if ((n >= 0) && (n < 24)) {
-    Adafruit_EyeLights_buffered *eyelights =
-        (Adafruit_EyeLights_buffered *)parent;
-    uint8_t *ledbuf = eyelights->getBuffer();
+    uint8_t *ledbuf = &parent->ledbuf[1]; // getBuffer() would flag ALL
     _IS31_SCALE_RGB_(color, r, g, b, _brightness);
-    n *= 3;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->rOffset])] = r;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->gOffset])] = g;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->bOffset])] = b;
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    ledbuf[idx[0]] = r;
+    ledbuf[idx[1]] = g;
+    ledbuf[idx[2]] = b;
+    parent->markDirty(idx[0]);
+    parent->markDirty(idx[1]);
+    parent->markDirty(idx[2]);
   }
 }
 
@@ -1157,14 +2233,16 @@ void Adafruit_EyeLights_Ring_buffered::setPixelColor(int16_t n,
 void Adafruit_EyeLights_Ring_buffered::setPixelColor(int16_t n, uint8_t r,
                                                      uint8_t g, uint8_t b) {
   if ((n >= 0) && (n < 24)) {
-    Adafruit_EyeLights_buffered *eyelights =
-        (Adafruit_EyeLights_buffered *)parent;
-    uint8_t *ledbuf = eyelights->getBuffer();
+    uint8_t *ledbuf = &parent->ledbuf[1]; // getBuffer() would flag ALL
     _IS31_SCALE_RGB_SEPARATE_(r, g, b, _brightness);
-    n *= 3;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->rOffset])] = r;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->gOffset])] = g;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->bOffset])] = b;
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    ledbuf[idx[0]] = r;
+    ledbuf[idx[1]] = g;
+    ledbuf[idx[2]] = b;
+    parent->markDirty(idx[0]);
+    parent->markDirty(idx[1]);
+    parent->markDirty(idx[2]);
   }
 }
 
@@ -1177,14 +2255,17 @@ void Adafruit_EyeLights_Ring_buffered::setPixelColor(int16_t n, uint8_t r,
 */
 /**************************************************************************/
 void Adafruit_EyeLights_Ring_buffered::fill(uint32_t color) {
-  Adafruit_EyeLights_buffered *eyelights =
-      (Adafruit_EyeLights_buffered *)parent;
-  uint8_t *ledbuf = eyelights->getBuffer();
+  uint8_t *ledbuf = &parent->ledbuf[1]; // getBuffer() would flag ALL
   _IS31_SCALE_RGB_(color, r, g, b, _brightness);
-  for (uint8_t n = 0; n < 24 * 3; n += 3) {
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->rOffset])] = r;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->gOffset])] = g;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->bOffset])] = b;
+  for (uint8_t n = 0; n < 24; n++) {
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    ledbuf[idx[0]] = r;
+    ledbuf[idx[1]] = g;
+    ledbuf[idx[2]] = b;
+    parent->markDirty(idx[0]);
+    parent->markDirty(idx[1]);
+    parent->markDirty(idx[2]);
   }
 }
 
@@ -1199,42 +2280,85 @@ void Adafruit_EyeLights_Ring_buffered::fill(uint32_t color) {
 */
 /**************************************************************************/
 void Adafruit_EyeLights_Ring_buffered::fill(uint8_t r, uint8_t g, uint8_t b) {
-  Adafruit_EyeLights_buffered *eyelights =
-      (Adafruit_EyeLights_buffered *)parent;
-  uint8_t *ledbuf = eyelights->getBuffer();
+  uint8_t *ledbuf = &parent->ledbuf[1]; // getBuffer() would flag ALL
   _IS31_SCALE_RGB_SEPARATE_(r, g, b, _brightness);
-  for (uint8_t n = 0; n < 24 * 3; n += 3) {
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->rOffset])] = r;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->gOffset])] = g;
-    ledbuf[pgm_read_word(&ring_map[n + eyelights->bOffset])] = b;
+  for (uint8_t n = 0; n < 24; n++) {
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    ledbuf[idx[0]] = r;
+    ledbuf[idx[1]] = g;
+    ledbuf[idx[2]] = b;
+    parent->markDirty(idx[0]);
+    parent->markDirty(idx[1]);
+    parent->markDirty(idx[2]);
   }
 }
 
 /**************************************************************************/
 /*!
-    @brief         Adafruit GFX low level accessor - sets an RGB pixel value
-                   on buffered EyeLights LED matrix. No immediate effect on
-                   LEDs, must follow up with show().
-    @param  x      The x position, starting with 0 for left-most side
-    @param  y      The y position, starting with 0 for top-most side
-    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+    @brief  Set multiple pixels of one buffered EyeLights ring,
+            from an array of packed RGB values. Brightness is applied
+            once per pixel in a single pass.
+    @param  colors  Array of RGB888 (24-bit) colors, a la NeoPixel.
+    @param  count   Number of colors in array (0-24, default 24).
+    @param  rotate  Ring pixel index (0-23) where colors[0] is placed,
+                    subsequent colors follow in index order, wrapping
+                    around. Spinning patterns can be drawn by changing
+                    this each frame rather than recomputing colors.
 */
 /**************************************************************************/
-void Adafruit_EyeLights_buffered::drawPixel(int16_t x, int16_t y,
-                                            uint16_t color) {
-  if ((x >= 0) && (x < width()) && (y >= 0) && (y < height())) {
-    _IS31_ROTATE_(x, y); // Handle GFX-style soft rotation
-    x = (x * 5 + y) * 3; // Base index into ledmap
-    uint16_t ridx = pgm_read_word(&glassesmatrix_ledmap[x + rOffset]);
-    if (ridx != 65535) {
-      uint16_t gidx = pgm_read_word(&glassesmatrix_ledmap[x + gOffset]);
-      uint16_t bidx = pgm_read_word(&glassesmatrix_ledmap[x + bOffset]);
-      uint8_t *ledbuf = getBuffer();
-      _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
-      ledbuf[ridx] = r;
-      ledbuf[gidx] = g;
-      ledbuf[bidx] = b;
-    }
+void Adafruit_EyeLights_Ring_buffered::setPixels(
+    const uint32_t *colors, uint8_t count, uint8_t rotate) {
+  if (count > 24)
+    count = 24;
+  uint8_t n = rotate % 24;
+  uint8_t *ledbuf = &parent->ledbuf[1]; // getBuffer() would flag ALL
+  for (uint8_t i = 0; i < count; i++) {
+    _IS31_SCALE_RGB_(colors[i], r, g, b, _brightness);
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    ledbuf[idx[0]] = r;
+    ledbuf[idx[1]] = g;
+    ledbuf[idx[2]] = b;
+    parent->markDirty(idx[0]);
+    parent->markDirty(idx[1]);
+    parent->markDirty(idx[2]);
+    if (++n >= 24)
+      n = 0;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set multiple pixels of one buffered EyeLights ring,
+            from an array of separate R,G,B bytes. Brightness is applied
+            once per pixel in a single pass.
+    @param  rgb     Array of 8-bit R,G,B values, 3 bytes per pixel.
+    @param  count   Number of pixels in array (0-24, default 24).
+    @param  rotate  Ring pixel index (0-23) where the first pixel is placed,
+                    subsequent pixels follow in index order, wrapping
+                    around.
+*/
+/**************************************************************************/
+void Adafruit_EyeLights_Ring_buffered::setPixels(
+    const uint8_t *rgb, uint8_t count, uint8_t rotate) {
+  if (count > 24)
+    count = 24;
+  uint8_t n = rotate % 24;
+  uint8_t *ledbuf = &parent->ledbuf[1]; // getBuffer() would flag ALL
+  for (uint8_t i = 0; i < count; i++, rgb += 3) {
+    uint8_t r = rgb[0], g = rgb[1], b = rgb[2];
+    _IS31_SCALE_RGB_SEPARATE_(r, g, b, _brightness);
+    uint16_t idx[3];
+    ringLEDs(n, *parent, idx);
+    ledbuf[idx[0]] = r;
+    ledbuf[idx[1]] = g;
+    ledbuf[idx[2]] = b;
+    parent->markDirty(idx[0]);
+    parent->markDirty(idx[1]);
+    parent->markDirty(idx[2]);
+    if (++n >= 24)
+      n = 0;
   }
 }
 
@@ -1247,42 +2371,63 @@ void Adafruit_EyeLights_buffered::drawPixel(int16_t x, int16_t y,
             the rings. This is different than using normal drawing
             operations directly to the low-resolution matrix, where these
             ops are "transparent" and empty pixels don't overwrite the
-            rings.
+            rings. With a change-tracking canvas, only pixels drawn to
+            since the last call are overwritten.
 */
 /**************************************************************************/
 void Adafruit_EyeLights_buffered::scale(void) {
-  if (canvas) {
-    uint16_t *src = canvas->getBuffer();
-    uint8_t *ledbuf = getBuffer();
-    // Outer x/y loops are column-major on purpose (less pointer math)
-    for (int x = 0; x < 18; x++) {
-      uint16_t *ptr = &src[x * 3]; // Entry along top scan line w/x offset
-      for (int y = 0; y < 5; y++) {
-        uint16_t rsum = 0, gsum = 0, bsum = 0;
-        // Inner x/y loops are row-major on purpose (less pointer math)
-        for (uint8_t yy = 0; yy < 3; yy++) {
-          for (uint8_t xx = 0; xx < 3; xx++) {
-            uint16_t rgb = ptr[xx];
-            rsum += rgb >> 11;         // Accumulate 5 bits red,
-            gsum += (rgb >> 5) & 0x3F; // 6 bits green,
-            bsum += rgb & 0x1F;        // 5 bits blue
-          }
-          ptr += canvas->width(); // Advance one scan line
-        }
-        uint16_t base = (x * 5 + y) * 3; // Offset into ledmap
-        uint16_t ridx = pgm_read_word(&glassesmatrix_ledmap[base + rOffset]);
-        if (ridx != 65535) {
-          uint16_t gidx = pgm_read_word(&glassesmatrix_ledmap[base + gOffset]);
-          uint16_t bidx = pgm_read_word(&glassesmatrix_ledmap[base + bOffset]);
-          ledbuf[ridx] = pgm_read_byte(&gammaRB[rsum]);
-          ledbuf[gidx] = pgm_read_byte(&gammaG[gsum]);
-          ledbuf[bidx] = pgm_read_byte(&gammaRB[bsum]);
-        }
-      }
-    }
+  scaleCanvas(canvas, ledMap(*this), tracked);
+}
+
+/**************************************************************************/
+/*!
+    @brief    Identify an LED's color for show-time color correction. As
+              with the matrix, plus the ring-only LEDs.
+    @param    led  LED index, 0 to 350.
+    @returns  0 for red, 1 for green, 2 for blue, 3 if unused.
+*/
+/**************************************************************************/
+uint8_t Adafruit_EyeLights_buffered::ledChannel(uint16_t led) {
+  uint8_t c = Adafruit_IS31FL3741_Matrix_buffered::ledChannel(led);
+  return (c < 3) ? c : ringChannel(led, this);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set one ring pixel of 16-bit EyeLights. No immediate effect on
+            LEDs; must follow up with show().
+    @param  right  false for left ring, true for right ring.
+    @param  n      Index of pixel to set (0-23).
+    @param  r      Red brightness, 0 to 65535.
+    @param  g      Green brightness, 0 to 65535.
+    @param  b      Blue brightness, 0 to 65535.
+*/
+/**************************************************************************/
+void Adafruit_EyeLights_dithered::setRingPixelColor16(bool right, int16_t n,
+                                                      uint16_t r, uint16_t g,
+                                                      uint16_t b) {
+  if ((n >= 0) && (n < 24)) {
+    const uint16_t *ring_map = right ? right_ring_map : left_ring_map;
+    n *= 3; // Ring map is RGB triplets
+    buf16[pgm_read_word(&ring_map[n + rOffset])] = r;
+    buf16[pgm_read_word(&ring_map[n + gOffset])] = g;
+    buf16[pgm_read_word(&ring_map[n + bOffset])] = b;
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief    Identify an LED's color for show-time color correction, as
+              with Adafruit_EyeLights_buffered.
+    @param    led  LED index, 0 to 350.
+    @returns  0 for red, 1 for green, 2 for blue, 3 if unused.
+*/
+/**************************************************************************/
+uint8_t Adafruit_EyeLights_dithered::ledChannel(uint16_t led) {
+  uint8_t c = Adafruit_IS31FL3741_Matrix_dithered::ledChannel(led);
+  return (c < 3) ? c : ringChannel(led, this);
+}
+
 // ORIGINAL LED GLASSES API (DIRECT, UNBUFFERED) ---------------------------
 // These classes and functions are deprecated in favor of the EyeLights
 // versions, which are a bit simpler to use. Code is kept around for
@@ -18,6 +18,58 @@
 #define IS3741_FUNCREG_GCURRENT 0x01
 #define IS3741_FUNCREG_RESET 0x3F
 
+// Max number of LED register writes held between beginBatch() and
+// endBatch() before they're sent, for the queue built into direct GFX
+// boards (buffered objects have none). Each costs 3 bytes RAM. Compiler
+// flag, as below; from the Arduino IDE, use setBatchQueue() instead.
+#ifndef IS3741_BATCH_SIZE
+#define IS3741_BATCH_SIZE 31
+#endif
+
+// Default current of one LED, in milliamps, at full PWM, scaling and global
+// current, for setPowerLimit(). The real figure depends on the board's
+// current-set resistor; this errs on the high side, i.e. toward limiting.
+#ifndef IS3741_LED_MA
+#define IS3741_LED_MA 38.0
+#endif
+
+// Define IS3741_RING_RAM to have each EyeLights ring copy its LED indices,
+// already resolved for the color order, to RAM (146 bytes per ring) rather
+// than reading them from flash with the color offsets added on every pixel.
+// The copy is redone if the color order changes. Faster ring drawing for
+// boards with RAM to spare. Compiler flag, as below.
+
+// Define IS3741_STATS to have each object count its I2C traffic, see
+// getStats(). This must be a compiler flag (e.g. build_flags in PlatformIO)
+// so the library sees it too; a #define in the sketch isn't enough.
+#if defined(IS3741_STATS)
+/*!
+    @brief  I2C traffic and timing counters returned by getStats().
+*/
+typedef struct {
+  uint32_t transactions; ///< I2C transactions issued (writes and reads)
+  uint32_t bytes;        ///< Bytes written and read, incl. register addrs
+  uint32_t reads;        ///< Register reads (address write, then a read)
+  uint32_t pageHits;     ///< selectPage() calls skipped thanks to cache
+  uint32_t pageMisses;   ///< selectPage() calls that switched page
+  uint32_t unlocks;      ///< Command register unlock writes
+  uint32_t failures;     ///< Transactions that weren't acknowledged
+  uint32_t showLast;     ///< Duration of most recent show(), microseconds
+  uint32_t showMin;      ///< Shortest show(), 0xFFFFFFFF if none yet
+  uint32_t showMax;      ///< Longest show(), microseconds
+} IS3741_stats;
+#endif
+
+/*!
+    @brief  One LED register write held in a batch queue, see
+            setBatchQueue().
+*/
+typedef struct {
+  uint8_t page;  ///< Register page
+  uint8_t reg;   ///< Register within page
+  uint8_t value; ///< Value to write
+} IS3741_batchEntry;
+
 // RGB pixel color order permutations
 typedef enum {
   // Offset:     R          G          B
@@ -29,6 +81,12 @@ typedef enum {
   IS3741_BGR = ((2 << 4) | (1 << 2) | (0)), // Encode as B,G,R
 } IS3741_order;
 
+// Downsampling filters for Adafruit_IS31FL3741_Scaler
+typedef enum {
+  IS3741_BOX,  // Average of each pixel's own block of canvas pixels
+  IS3741_TENT, // Weighted toward block center, overlapping neighbors
+} IS3741_kernel;
+
 // 8-bit gamma correction table for the gamma8() and gamma32() funcs.
 static const uint8_t PROGMEM _IS31GammaTable[256] = {
     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
@@ -50,6 +108,47 @@ static const uint8_t PROGMEM _IS31GammaTable[256] = {
     218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252,
     255};
 
+// drawPixel() for the various board classes does these steps the same way;
+// done as #defines (rather than functions) to avoid call overhead in the
+// lowest-level functions.
+
+#ifndef _swap_int16_t
+#define _swap_int16_t(a, b)                                                    \
+  {                                                                            \
+    int16_t t = a;                                                             \
+    a = b;                                                                     \
+    b = t;                                                                     \
+  }
+#endif
+
+// This does GFX-style "soft rotation" in each drawPixel():
+#define _IS31_ROTATE_(_X_, _Y_)                                                \
+  switch (getRotation()) {                                                     \
+  case 1:                                                                      \
+    _swap_int16_t(_X_, _Y_);                                                   \
+    _X_ = WIDTH - 1 - _X_;                                                     \
+    break;                                                                     \
+  case 2:                                                                      \
+    _X_ = WIDTH - 1 - _X_;                                                     \
+    _Y_ = HEIGHT - 1 - _Y_;                                                    \
+    break;                                                                     \
+  case 3:                                                                      \
+    _swap_int16_t(_X_, _Y_);                                                   \
+    _Y_ = HEIGHT - 1 - _Y_;                                                    \
+    break;                                                                     \
+  }
+
+// This looks up a layout's slot() value in its packed 2-bit slotmap table.
+#define _IS31_SLOT_(_MAP_, _LED_)                                              \
+  ((pgm_read_byte(&_MAP_[(_LED_) >> 2]) >> (((_LED_)&3) * 2)) & 3)
+
+// This expands a GFX-style RGB565 color to RGB888 in 3 uint8_t variables,
+// declared here, i.e. at the corresponding position in the drawPixel() func.
+#define _IS31_EXPAND_(_COLOR_, _R_, _G_, _B_)                                  \
+  uint8_t _R_ = ((_COLOR_ >> 8) & 0xF8) | (_COLOR_ >> 13);                     \
+  uint8_t _G_ = ((_COLOR_ >> 3) & 0xFC) | ((_COLOR_ >> 9) & 0x03);             \
+  uint8_t _B_ = ((_COLOR_ << 3) & 0xF8) | ((_COLOR_ >> 2) & 0x07);
+
 // BASE IS31 CLASSES -------------------------------------------------------
 
 /**************************************************************************/
@@ -67,6 +166,18 @@ public:
     @brief  Constructor for IS31FL3741 LED driver.
   */
   Adafruit_IS31FL3741() {}
+  /*!
+    @brief  Destructor for IS31FL3741 LED driver, frees the I2C device.
+  */
+  ~Adafruit_IS31FL3741() { delete _i2c_dev; }
+  /*!
+    @brief  Not copyable; the object owns its I2C device.
+  */
+  Adafruit_IS31FL3741(const Adafruit_IS31FL3741 &) = delete;
+  /*!
+    @brief  Not assignable, for the same reason as the copy constructor.
+  */
+  Adafruit_IS31FL3741 &operator=(const Adafruit_IS31FL3741 &) = delete;
   bool begin(uint8_t addr = IS3741_ADDR_DEFAULT, TwoWire *theWire = &Wire);
   bool reset(void);
   bool enable(bool en);
@@ -78,10 +189,36 @@ public:
 
   bool setLEDscaling(uint16_t lednum, uint8_t scale);
   bool setLEDscaling(uint8_t scale);
+  bool setBrightness(uint8_t b);
 
   bool setLEDPWM(uint16_t lednum, uint8_t pwm);
   bool fill(uint8_t fillpwm = 0);
 
+  /*!
+    @brief  Start queuing LED PWM and scaling writes rather than issuing
+            each immediately. At endBatch() they're sorted and merged into
+            as few I2C transfers as possible (the queue is also flushed
+            early if it fills). Calls may be nested; only the outermost
+            endBatch() sends. GFX drawing does this automatically. Needs
+            a queue: direct GFX boards have one, a plain
+            Adafruit_IS31FL3741 can be given one with setBatchQueue().
+            Without one, writes are issued immediately as usual.
+  */
+  void beginBatch(void) { _batchDepth++; }
+  bool endBatch(void);
+  void setBatchQueue(IS3741_batchEntry *queue, uint8_t size);
+
+#if defined(IS3741_STATS)
+  /*!
+    @brief    Get I2C traffic and timing counters for this object. Only
+              available if the library is compiled with IS3741_STATS.
+    @returns  const IS3741_stats&  Counters accumulated since the object
+              was created or resetStats() was last called.
+  */
+  const IS3741_stats &getStats(void) const { return _stats; }
+  void resetStats(void);
+#endif
+
   /*!
     @brief  Empty function makes direct & buffered code more interchangeable.
             Direct classes have an immediate effect when setting LED states,
@@ -164,12 +301,92 @@ public:
 protected:
   bool selectPage(uint8_t page);
   bool setLEDvalue(uint8_t first_page, uint16_t lednum, uint8_t value);
+  bool writeGlobalCurrent(uint8_t current);
   bool fillTwoPages(uint8_t first_page, uint8_t value);
+  bool flushBatch(void);
+  /*!
+    @brief    Tally one I2C transaction in the stats block, if enabled.
+              Compiles to nothing otherwise.
+    @param    ok     Transaction status.
+    @param    bytes  Bytes written, including register address.
+    @returns  ok, passed through.
+  */
+  bool counted(bool ok, uint16_t bytes) {
+#if defined(IS3741_STATS)
+    _stats.transactions++;
+    _stats.bytes += bytes;
+    if (!ok)
+      _stats.failures++;
+#else
+    (void)bytes;
+#endif
+    return ok;
+  }
+  /*!
+    @brief    Tally one single-byte register read in the stats block, if
+              enabled, after it's happened. On the bus that's two
+              transactions: the register address written, then the value
+              read. Compiles to nothing otherwise.
+    @param    ok  Read status.
+    @returns  ok, passed through.
+  */
+  bool countedRead(bool ok) {
+#if defined(IS3741_STATS)
+    _stats.transactions += 2;
+    _stats.bytes += 2;
+    _stats.reads++;
+    if (!ok)
+      _stats.failures++;
+#endif
+    return ok;
+  }
+#if defined(IS3741_STATS)
+  void countShow(uint32_t us);
+
+  IS3741_stats _stats = {0, 0, 0, 0, 0, 0, 0, 0, 0xFFFFFFFF, 0}; ///< Counters
+#endif
 
   int8_t _page = -1; ///< Cached value of the page we're currently addressing
   Adafruit_I2CDevice *_i2c_dev = NULL; ///< Pointer to I2C device
+
+  int16_t _gcc = -1;     ///< Last global current requested, -1 if unknown
+  int16_t _gccOut = -1;  ///< Last global current written, -1 if unknown
+  int16_t _scale = -1;   ///< Last scaling written to all LEDs, -1 if unknown
+  uint8_t _gccCap = 255; ///< Max global current written, for power limit
+
+  IS3741_batchEntry *_batch = NULL; ///< Batch queue, NULL if none
+  uint8_t _batchSize = 0;  ///< Capacity of batch queue
+  uint8_t _batchDepth = 0; ///< beginBatch() nesting level, 0 = not batching
+  uint8_t _batchCount = 0; ///< Number of writes in batch queue
 };
 
+/*!
+    @brief  Show-time color correction state of a buffered object. Only
+            allocated once color correction is used, see setGamma().
+*/
+typedef struct {
+  uint8_t table[3][256]; ///< R, G, B tables: gamma, white, brightness
+  uint8_t map[88];       ///< 2-bit table index per LED, 3 = brightness only
+  uint8_t curve[3][256]; ///< R, G, B gamma curves alone
+  float gamma[3];        ///< Exponent per channel
+  uint8_t white[3];      ///< White balance per channel
+  uint8_t bright;        ///< Overall brightness
+  bool stale;            ///< If set, tables are rebuilt on next show()
+} IS3741_lut;
+
+/*!
+    @brief  Power model state of a buffered object. Only allocated once
+            the model is enabled, see setPowerLimit().
+*/
+typedef struct {
+  float ledMilliamps;    ///< Current of one LED at full on
+  float estimate;        ///< Estimated LED milliamps as of last show()
+  uint16_t limit;        ///< Max LED milliamps, 0 = estimate only
+  uint16_t stale;        ///< Bitmask of blockSum[] needing recalculation
+  uint16_t blockSum[11]; ///< Sum of PWM values of each 32 LEDs
+  int16_t gccPending;    ///< Global current to write when poll() is done
+} IS3741_power;
+
 /**************************************************************************/
 /*!
     @brief  Class for a "buffered" Lumissil IS31FL3741 LED driver -- LED PWM
@@ -178,20 +395,166 @@ protected:
             functionally identical. LED scaling values (vs PWM) are NOT
             staged in RAM and are issued individually as normal; scaling is
             infrequently used and not worth the extra memory it would incur.
+            LEDs changed since the prior show() are tracked (44 more bytes)
+            so only those spans are re-sent. showAsync() allows drawing the
+            next frame while the current one is sent in pieces by poll().
 */
 /**************************************************************************/
 class Adafruit_IS31FL3741_buffered : public Adafruit_IS31FL3741 {
 public:
   Adafruit_IS31FL3741_buffered();
+  ~Adafruit_IS31FL3741_buffered();
+  /*!
+    @brief  Not copyable; the object owns heap buffers (showAsync() and
+            color correction) that a copy would free twice.
+  */
+  Adafruit_IS31FL3741_buffered(const Adafruit_IS31FL3741_buffered &) = delete;
+  /*!
+    @brief  Not assignable, for the same reason as the copy constructor.
+  */
+  Adafruit_IS31FL3741_buffered &
+  operator=(const Adafruit_IS31FL3741_buffered &) = delete;
   bool begin(uint8_t addr = IS3741_ADDR_DEFAULT, TwoWire *theWire = &Wire);
   void show(void); // DON'T const this
+  bool showAsync(void);
+  void poll(void);
+  /*!
+    @brief    Check whether a transfer started with showAsync() is done.
+    @returns  true if complete (or none was started), false if poll()
+              still has data to send.
+  */
+  bool isShowComplete(void) const { return asyncled >= 351; }
+  /*!
+    @brief  Wait for a transfer started with showAsync() to complete,
+            calling poll() as needed. Returns immediately if none is in
+            progress.
+  */
+  void waitShow(void) {
+    while (!isShowComplete())
+      poll();
+  }
   /*!
-    @brief    Return address of LED buffer.
+    @brief    Return address of LED buffer. Since the caller may then
+              write anywhere in the buffer, this marks ALL LEDs as changed
+              so the next show() sends everything. Code that holds onto
+              this pointer across frames must call markDirty() for any
+              LEDs it changes later, else those changes won't be sent.
     @returns  uint8_t*  Pointer to first LED position in buffer.
   */
-  uint8_t *getBuffer(void) { return &ledbuf[1]; } // See notes in show()
+  uint8_t *getBuffer(void) { // See notes in show()
+    markDirty();
+    return &ledbuf[1];
+  }
+  /*!
+    @brief    Return read-only address of LED buffer, for code that only
+              inspects it. Called through a const object or reference
+              (e.g. const Adafruit_IS31FL3741_buffered &m = matrix;), so
+              unlike the writable getBuffer() no LEDs are marked changed.
+    @returns  const uint8_t*  Pointer to first LED position in buffer.
+  */
+  const uint8_t *getBuffer(void) const { return &ledbuf[1]; }
+  /*!
+    @brief  Flag all LEDs as changed, so next show() sends everything.
+  */
+  void markDirty(void) { memset(dirty, 0xFF, sizeof dirty); }
+  /*!
+    @brief  Flag one LED as changed, so next show() will send it.
+    @param  lednum  LED index, 0 to 350. Out-of-range values are ignored.
+  */
+  void markDirty(uint16_t lednum) {
+    if (lednum < 351)
+      dirty[lednum >> 3] |= 1 << (lednum & 7);
+  }
+  void markDirty(uint16_t first, uint16_t count);
+  /*!
+    @brief  Enable or disable "always full" show() behavior, where all
+            LEDs are sent each time regardless of what's changed. This is
+            an escape hatch for code writing to the getBuffer() pointer
+            without calling markDirty(). Default is false.
+    @param  full  true to always send all LEDs, false to send only changes.
+  */
+  void setFullRefresh(bool full) { fullRefresh = full; }
+  /*!
+    @brief    Get number of LED bytes sent by show() since the counters
+              were last reset. Bytes bridging small gaps between changed
+              spans are counted here, as they're actually transmitted.
+    @returns  uint32_t  LED bytes sent.
+  */
+  uint32_t getBytesSent(void) const { return bytesSent; }
+  /*!
+    @brief    Get number of LED bytes NOT sent by show() (because they were
+              unchanged) since the counters were last reset.
+    @returns  uint32_t  LED bytes skipped.
+  */
+  uint32_t getBytesSkipped(void) const { return bytesSkipped; }
+  /*!
+    @brief  Reset the getBytesSent() and getBytesSkipped() counters.
+  */
+  void resetByteCounts(void) { bytesSent = bytesSkipped = 0; }
+  // Show-time color correction. These are documented in .cpp file:
+  void setGamma(float gamma);
+  void setGamma(float r, float g, float b);
+  void setWhiteBalance(uint8_t r, uint8_t g, uint8_t b);
+  void setLUTBrightness(uint8_t b);
+  void clearColorCorrection(void);
+  void setPowerLimit(uint16_t milliamps, float ledMilliamps = IS3741_LED_MA);
+  /*!
+    @brief    Get total LED current estimated by the power model (see
+              setPowerLimit()) as of the last show(), after any limiting.
+              This is LED current only, not the chip or anything else.
+    @returns  float  Milliamps, or 0 if the power model isn't enabled.
+  */
+  float getEstimatedCurrent(void) const {
+    return power ? power->estimate : 0;
+  }
+
 protected:
+  /*!
+    @brief    Identify an LED's color, for show-time color correction.
+              Board classes that know their LED arrangement override
+              this; the base class doesn't, so LEDs get brightness
+              adjustment only.
+    @param    led  LED index, 0 to 350.
+    @returns  0 for red, 1 for green, 2 for blue, 3 if unknown.
+  */
+  virtual uint8_t ledChannel(uint16_t led) {
+    (void)led;
+    return 3;
+  }
+  bool allocLUT(void);
+  void updateGamma(void);
+  bool updateLUT(void);
+  int16_t updatePower(bool correct);
+
   uint8_t ledbuf[352]; ///< LEDs in RAM. +1 byte is intentional, see show()
+  uint8_t dirty[44];   ///< Bitmask of LEDs changed since last show()
+
+  bool fullRefresh = false;  ///< If set, show() always sends all LEDs
+  uint32_t bytesSent = 0;    ///< LED bytes sent by show()
+  uint32_t bytesSkipped = 0; ///< LED bytes skipped by show()
+
+  uint8_t *asyncbuf = NULL; ///< showAsync() frame copy + changed-LED mask
+  uint16_t asyncled = 351;  ///< Next LED for poll() to send, 351 if done
+
+  IS3741_lut *lut = NULL;     ///< Color correction, NULL if not in use
+  IS3741_power *power = NULL; ///< Power model, NULL if not in use
+
+  /*!
+    @brief    Pass one LED value through the color correction tables.
+    @param    led    LED index, 0 to 350.
+    @param    value  Uncorrected value from LED buffer.
+    @returns  Corrected value.
+  */
+  uint8_t lutValue(uint16_t led, uint8_t value) const {
+    uint8_t c = (lut->map[led >> 2] >> ((led & 3) * 2)) & 3;
+    return (c < 3) ? lut->table[c][value]
+                   : ((uint16_t)value * (lut->bright + 1)) >> 8;
+  }
+  uint16_t skipClean(const uint8_t *mask, uint16_t led);
+  uint16_t sendSpan(uint8_t *buf, const uint8_t *mask, uint16_t led,
+                    bool correct = false);
+
+  friend class Adafruit_IS31FL3741_Scaler; // Scaler writes ledbuf
 };
 
 // INTERMEDIARY CLASSES FOR COLORS AND GFX ---------------------------------
@@ -244,6 +607,19 @@ public:
                                IS3741_order order);
   // Overload the base (monochrome) fill() with a GFX RGB565-style color.
   void fill(uint16_t color = 0);
+  /*!
+    @brief  GFX calls this before a series of writePixel() calls (e.g. when
+            drawing lines or text); the LED writes are batched together.
+  */
+  void startWrite(void) { beginBatch(); }
+  /*!
+    @brief  GFX calls this after a series of writePixel() calls; the LED
+            writes batched since startWrite() are sent.
+  */
+  void endWrite(void) { endBatch(); }
+
+private:
+  IS3741_batchEntry batchQueue[IS3741_BATCH_SIZE]; ///< For beginBatch()
 };
 
 /**************************************************************************/
@@ -273,6 +649,151 @@ public:
   void fill(uint16_t color = 0);
 };
 
+/**************************************************************************/
+/*!
+    @brief  Class for antialiased downsampling of a larger GFXcanvas16 to
+            an LED matrix, i.e. the technique of Adafruit_EyeLights'
+            scale(), but for any layout, a 2X, 3X or 4X canvas, box or
+            tent filter and any gamma. All the setup is done in begin(),
+            which allocates LED indices for each matrix pixel (6 bytes per
+            pixel) plus a 256-byte gamma table; scale() then uses only
+            integer math. A smaller ratio saves canvas RAM, a larger ratio
+            or the tent filter gives smoother results.
+*/
+/**************************************************************************/
+class Adafruit_IS31FL3741_Scaler {
+public:
+  /*!
+    @brief  Constructor for scaler. Call begin() before use.
+  */
+  Adafruit_IS31FL3741_Scaler(void) {}
+  ~Adafruit_IS31FL3741_Scaler(void) { free(targets); }
+  /*!
+    @brief    Allocate and compute tables for downsampling to a layout.
+              Can be called again to change settings.
+    @param    order   Color order of matrix, usually the matrix object
+                      itself.
+    @param    ratio   Canvas pixels per matrix pixel, horizontally and
+                      vertically: 2, 3 (default) or 4. The canvas passed
+                      to scale() must be this much larger than the layout.
+    @param    kernel  IS3741_BOX (default) or IS3741_TENT.
+    @param    gamma   Gamma correction exponent, default 2.6 (1.0 is
+                      linear).
+    @returns  true on success, false if ratio is out of range or memory
+              could not be allocated.
+  */
+  template <class Layout>
+  bool begin(const Adafruit_IS31FL3741_ColorOrder &order, uint8_t ratio = 3,
+             IS3741_kernel kernel = IS3741_BOX, float gamma = 2.6) {
+    if (!alloc(Layout::width, Layout::height, ratio, kernel, gamma))
+      return false;
+    uint16_t *t = targets;
+    for (uint8_t y = 0; y < Layout::height; y++) {
+      for (uint8_t x = 0; x < Layout::width; x++) {
+        *t++ = Layout::led(x, y, order.rOffset); // 65535 if unmapped
+        *t++ = Layout::led(x, y, order.gOffset);
+        *t++ = Layout::led(x, y, order.bOffset);
+      }
+    }
+    return true;
+  }
+  void scale(const GFXcanvas16 *canvas, Adafruit_IS31FL3741 &matrix);
+  void scale(const GFXcanvas16 *canvas, Adafruit_IS31FL3741_buffered &matrix);
+
+protected:
+  bool alloc(uint8_t width, uint8_t height, uint8_t ratio,
+             IS3741_kernel kernel, float gamma);
+  void sample(const GFXcanvas16 *canvas, uint8_t x, uint8_t y,
+              uint8_t *rgb) const;
+
+  uint16_t *targets = NULL; ///< R,G,B LED indices per pixel, + gamma table
+  uint8_t *gammaTable;      ///< 256 entries, follows targets
+  uint32_t multRB = 0;      ///< Fixed-point normalizer for red, blue sums
+  uint32_t multG = 0;       ///< Fixed-point normalizer for green sums
+  uint8_t width = 0;        ///< Matrix width in pixels
+  uint8_t height = 0;       ///< Matrix height in pixels
+  uint8_t ratio = 0;        ///< Canvas pixels per matrix pixel
+  uint8_t taps = 0;         ///< Number of filter weights
+  int8_t first = 0;         ///< Offset of first filter tap from block
+  uint8_t weight[8];        ///< Filter weights, each axis
+};
+
+/**************************************************************************/
+/*!
+    @brief  GFXcanvas16 that also records which 3x3 blocks (i.e. which
+            matrix pixels, once downsampled) have been drawn to since the
+            last scale(), so scale() can skip unchanged blocks entirely,
+            neither recomputing them nor (on buffered matrices) flagging
+            their LEDs for show(). Useful when most of the image is static
+            and only a small element moves. Costs one bit per block in
+            addition to the canvas itself. Requested via the board classes'
+            constructors; not usually instantiated in user code.
+*/
+/**************************************************************************/
+class Adafruit_IS31FL3741_TrackedCanvas : public GFXcanvas16 {
+public:
+  Adafruit_IS31FL3741_TrackedCanvas(uint16_t w, uint16_t h);
+  ~Adafruit_IS31FL3741_TrackedCanvas(void) { delete[] blocks; }
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void fillScreen(uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+  /*!
+    @brief  Flag the whole canvas as changed, e.g. after writing directly
+            to getBuffer(), which can't be tracked.
+  */
+  void markDirty(void) {
+    if (blocks)
+      memset(blocks, 0xFF, (cols * rows + 7) / 8);
+  }
+  /*!
+    @brief  Flag the whole canvas as unchanged. Called by scale().
+  */
+  void clean(void) {
+    if (blocks)
+      memset(blocks, 0, (cols * rows + 7) / 8);
+  }
+  /*!
+    @brief    Query whether a 3x3 block has changed since last clean().
+    @param    bx  Block column (canvas x / 3, unrotated).
+    @param    by  Block row (canvas y / 3, unrotated).
+    @returns  true if changed (or tracking memory couldn't be allocated),
+              false if unchanged.
+  */
+  bool isDirty(uint8_t bx, uint8_t by) const {
+    uint16_t n = by * cols + bx;
+    return !blocks || (blocks[n / 8] & (1 << (n & 7)));
+  }
+
+protected:
+  uint8_t *blocks; ///< One bit per 3x3 block, row-major, set if changed
+  uint8_t cols;    ///< Blocks per row
+  uint8_t rows;    ///< Rows of blocks
+};
+
+/**************************************************************************/
+/*!
+    @brief  1:3 antialiased downsampling of GFXcanvas16, GFXcanvas8 and
+            GFXcanvas1, shared by the Matrix class templates' scale()
+            support. Static functions only; not used in user code.
+*/
+/**************************************************************************/
+struct IS3741_downsample {
+  static bool canvasFits(const Adafruit_GFX *canvas, uint8_t cols,
+                         uint8_t rows);
+  static void scaleRow(const GFXcanvas16 *canvas, const uint16_t *unused,
+                       uint8_t cols, uint8_t y, uint8_t x0, uint8_t width,
+                       uint32_t *acc);
+  static void scaleRow(const GFXcanvas8 *canvas, const uint16_t *palette,
+                       uint8_t cols, uint8_t y, uint8_t x0, uint8_t width,
+                       uint32_t *acc);
+  static void scaleRow(const GFXcanvas1 *canvas, const uint32_t *levels,
+                       uint8_t cols, uint8_t y, uint8_t x0, uint8_t width,
+                       uint32_t *acc);
+  static void monoLevels(uint16_t fg, uint16_t bg, uint32_t *levels);
+};
+
 /* =======================================================================
    So, IN PRINCIPLE, additional classes Adafruit_IS31FL3741_monoGFX and
    Adafruit_IS31FL3741_monoGFX_buffered could go here for hypothetical
@@ -289,188 +810,1600 @@ public:
    as needed (the optional canvas in glasses is an exception).
    =======================================================================*/
 
+/* =======================================================================
+   Each board's pixel arrangement is described by a "layout" struct: its
+   dimensions, and a static led() function mapping a pixel's (unrotated)
+   X/Y and color element to an LED index. The Matrix class templates that
+   follow take a layout as a parameter, so the mapping is inlined into
+   drawPixel() and friends and mostly folds away at compile time. Adding
+   a new board is then a matter of adding a layout; the EVB and QT classes
+   below are nothing more than that plus a default color order.
+   =======================================================================*/
+
 /**************************************************************************/
 /*!
-    @brief  Class for Lumissil IS31FL3741 OEM evaluation board, direct
-            (unbuffered).
+    @brief  Layout of Lumissil IS31FL3741 OEM evaluation board, 9x13.
 */
 /**************************************************************************/
-class Adafruit_IS31FL3741_EVB : public Adafruit_IS31FL3741_colorGFX {
-public:
+struct IS3741_EVB_layout {
+  static const uint8_t width = 9;   ///< Matrix width in pixels
+  static const uint8_t height = 13; ///< Matrix height in pixels
+  static const bool sparse = false; ///< true if some pixels are unmapped
   /*!
-    @brief  Constructor for Lumissil IS31FL3741 OEM evaluation board,
-            13x9 pixels, direct (unbuffered).
-    @param  order  One of the IS3741_order enumeration types for RGB
-                   sequence. Default is IS3741_BGR.
+    @brief    Map pixel to LED index.
+    @param    x  Unrotated column, 0 to width-1.
+    @param    y  Unrotated row, 0 to height-1.
+    @param    c  Element of RGB triplet, i.e. a ColorOrder offset (0-2).
+    @returns  LED index, 0 to 350.
   */
-  Adafruit_IS31FL3741_EVB(IS3741_order order = IS3741_BGR)
-      : Adafruit_IS31FL3741_colorGFX(9, 13, order) {}
-  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  static uint16_t led(uint8_t x, uint8_t y, uint8_t c) {
+    return ((y > 2) ? (x * 10 + 12 - y) : (92 + x * 3 - y)) * 3 + c;
+  }
+  static const uint8_t PROGMEM slotmap[88]; ///< Packed slot() values
+  /*!
+    @brief    Map LED index back to its element of an RGB triplet.
+    @param    led  LED index, 0 to 350.
+    @returns  Element of RGB triplet (i.e. compare against a ColorOrder
+              offset), 0-2, or 3 if the LED isn't part of the matrix.
+  */
+  static uint8_t slot(uint16_t led) { return _IS31_SLOT_(slotmap, led); }
 };
 
 /**************************************************************************/
 /*!
-    @brief  Class for Lumissil IS31FL3741 OEM evaluation board, buffered.
+    @brief  Layout of IS31FL3741 Adafruit STEMMA QT board, 13x9.
 */
 /**************************************************************************/
-class Adafruit_IS31FL3741_EVB_buffered
-    : public Adafruit_IS31FL3741_colorGFX_buffered {
-public:
+struct IS3741_QT_layout {
+  static const uint8_t width = 13;  ///< Matrix width in pixels
+  static const uint8_t height = 9;  ///< Matrix height in pixels
+  static const bool sparse = false; ///< true if some pixels are unmapped
   /*!
-    @brief  Constructor for Lumissil IS31FL3741 OEM evaluation board,
-            13x9 pixels, buffered.
-    @param  order  One of the IS3741_order enumeration types for RGB
-                   sequence. Default is IS3741_BGR.
+    @brief    Map pixel to LED index.
+    @param    x  Unrotated column, 0 to width-1.
+    @param    y  Unrotated row, 0 to height-1.
+    @param    c  Element of RGB triplet, i.e. a ColorOrder offset (0-2).
+    @returns  LED index, 0 to 350.
   */
-  Adafruit_IS31FL3741_EVB_buffered(IS3741_order order = IS3741_BGR)
-      : Adafruit_IS31FL3741_colorGFX_buffered(9, 13, order) {}
-  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  static uint16_t led(uint8_t x, uint8_t y, uint8_t c) {
+    // Remap the row (y): 0-8 become 8,5,4,3,2,1,0,7,6
+    y = y ? ((y < 7) ? (6 - y) : (14 - y)) : 8;
+    // Odd columns + last column rearrange color order vs constructor.
+    // Not a simple swap, essentially (n + 2) % 3.
+    if ((x & 1) || (x == 12))
+      c = c ? (c - 1) : 2;
+    return (x + ((x < 10) ? (y * 10) : (80 + y * 3))) * 3 + c;
+  }
+  static const uint8_t PROGMEM slotmap[88]; ///< Packed slot() values
+  /*!
+    @brief    Map LED index back to its element of an RGB triplet.
+    @param    led  LED index, 0 to 350.
+    @returns  Element of RGB triplet (i.e. compare against a ColorOrder
+              offset), 0-2, or 3 if the LED isn't part of the matrix.
+  */
+  static uint8_t slot(uint16_t led) { return _IS31_SLOT_(slotmap, led); }
 };
 
+// Pixel-to-LED table for EyeLights, see .cpp
+extern const uint16_t PROGMEM glassesmatrix_ledmap[18 * 5 * 3];
+
 /**************************************************************************/
 /*!
-    @brief  Class for IS31FL3741 Adafruit STEMMA QT board, direct
-            (unbuffered).
+    @brief  Layout of Adafruit EyeLights LED glasses matrix, 18x5.
 */
 /**************************************************************************/
-class Adafruit_IS31FL3741_QT : public Adafruit_IS31FL3741_colorGFX {
-public:
+struct IS3741_EyeLights_layout {
+  static const uint8_t width = 18; ///< Matrix width in pixels
+  static const uint8_t height = 5; ///< Matrix height in pixels
+  static const bool sparse = true; ///< true if some pixels are unmapped
   /*!
-    @brief  Constructor for STEMMA QT version (13 x 9 LEDs), direct
-            (unbuffered).
-    @param  order  One of the IS3741_order enumeration types for RGB
-                   sequence. Default is IS3741_BGR.
+    @brief    Map pixel to LED index.
+    @param    x  Unrotated column, 0 to width-1.
+    @param    y  Unrotated row, 0 to height-1.
+    @param    c  Element of RGB triplet, i.e. a ColorOrder offset (0-2).
+    @returns  LED index, 0 to 350, or 65535 if pixel is unmapped (the
+              corners and around the nose bridge).
   */
-  Adafruit_IS31FL3741_QT(IS3741_order order = IS3741_BGR)
-      : Adafruit_IS31FL3741_colorGFX(13, 9, order) {}
-  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  static uint16_t led(uint8_t x, uint8_t y, uint8_t c) {
+    return pgm_read_word(&glassesmatrix_ledmap[(x * 5 + y) * 3 + c]);
+  }
+  static const uint8_t PROGMEM slotmap[88]; ///< Packed slot() values
+  /*!
+    @brief    Map LED index back to its element of an RGB triplet.
+    @param    led  LED index, 0 to 350.
+    @returns  Element of RGB triplet (i.e. compare against a ColorOrder
+              offset), 0-2, or 3 if the LED isn't part of the matrix
+              (e.g. ring-only LEDs).
+  */
+  static uint8_t slot(uint16_t led) { return _IS31_SLOT_(slotmap, led); }
 };
 
 /**************************************************************************/
 /*!
-    @brief  Class for IS31FL3741 Adafruit STEMMA QT board, buffered.
+    @brief  Class template for an RGB LED matrix board, direct
+            (unbuffered). Dimensions and pixel mapping come from the
+            Layout struct at compile time; color order is still a
+            run-time setting, as it may vary between production runs.
 */
 /**************************************************************************/
-class Adafruit_IS31FL3741_QT_buffered
-    : public Adafruit_IS31FL3741_colorGFX_buffered {
+template <class Layout>
+class Adafruit_IS31FL3741_Matrix : public Adafruit_IS31FL3741_colorGFX {
 public:
   /*!
-    @brief  Constructor for STEMMA QT version (13 x 9 LEDs), buffered.
+    @brief  Constructor for matrix board, direct (unbuffered). This is
+            used internally by the library, not user code.
     @param  order  One of the IS3741_order enumeration types for RGB
-                   sequence. Default is IS3741_BGR.
+                   sequence.
   */
-  Adafruit_IS31FL3741_QT_buffered(IS3741_order order = IS3741_BGR)
-      : Adafruit_IS31FL3741_colorGFX_buffered(13, 9, order) {}
-  void drawPixel(int16_t x, int16_t y, uint16_t color);
-};
+  Adafruit_IS31FL3741_Matrix(IS3741_order order)
+      : Adafruit_IS31FL3741_colorGFX(Layout::width, Layout::height, order) {}
+  /*!
+    @brief  Set all pixels to one color. Rather than pixel-by-pixel, this
+            streams the repeating R/G/B pattern to the chip in multi-byte
+            transfers (a dozen or so for a full matrix). LEDs that aren't
+            part of the matrix (e.g. EyeLights ring-only LEDs) are left
+            untouched.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void fill(uint16_t color = 0) {
+    _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
+    uint8_t val[4];                // LED value for each slot() 0-2
+    val[rOffset] = r;
+    val[gOffset] = g;
+    val[bOffset] = b;
 
-/* =======================================================================
-   This is the newer and simpler way (to the user) of using Adafruit
-   EyeLights LED glasses. Declaring an EyeLights object (direct or
-   buffered) gets you the matrix and rings automatically; no need to
-   instantiate as separate objects, nor does one need to explicitly
-   declare a base Adafruit_IS31FL3741 object and pass it in. Internally
-   the code has a few more layers but the user doesn't need to see that.
-   =======================================================================*/
+    if (_batchCount) // Anything queued must go out before the fill
+      flushBatch();
 
-/**************************************************************************/
-/*!
-    @brief  Base class for EyeLights LED ring. Holds a few items that are
-            common to direct or buffered instances, left or right ring.
-*/
-/**************************************************************************/
-class Adafruit_EyeLights_Ring_Base {
-public:
-  Adafruit_EyeLights_Ring_Base(void *parent, bool isRight);
+    uint8_t buf[32]; // Same "safe bet" transfer size as fillTwoPages()
+    uint8_t len = 0; // Number of values in buf (after address byte)
+    for (uint16_t led = 0; led < 351; led++) {
+      uint8_t s = Layout::slot(led);
+      if (s < 3) {
+        if (!len) { // Starting a new transfer
+          selectPage(led >= 180);
+          buf[0] = (led >= 180) ? (led - 180) : led;
+        }
+        buf[++len] = val[s];
+      }
+      // Send at an unmapped LED, end of page or full buffer
+      if (len && ((s > 2) || (led == 179) || (led == 350) || (len == 31))) {
+        counted(_i2c_dev->write(buf, len + 1), len + 1); // +1 for addr
+        len = 0;
+      }
+    }
+  }
   /*!
-    @brief    Return number of LEDs in ring (a la NeoPixel)
-    @returns  int  Always 24.
+    @brief  Adafruit GFX low level accessor - sets an RGB pixel value,
+            handles rotation and pixel arrangement.
+    @param  x      The x position, starting with 0 for left-most side.
+    @param  y      The y position, starting with 0 for top-most side.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
   */
-  uint8_t numPixels(void) const { return 24; }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
+      _IS31_ROTATE_(x, y);           // Handle GFX-style soft rotation
+      _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
+      setRGB(x, y, r, g, b);
+    }
+  }
   /*!
-    @brief  Set brightness of LED ring. This is a mathematical brightness
-            scale applied to setPixel() colors when setting ring pixels,
-            distinct from any value passed to setLEDscaling() functions,
-            because matrix and rings share pixels.
-    @param  b  Brightness from 0 (off) to 255 (max).
+    @brief  Set a pixel from a packed 24-bit RGB color, at full precision
+            (vs drawPixel(), where RGB565 loses some low bits). Handles
+            rotation and pixel arrangement.
+    @param  x      The x position, starting with 0 for left-most side.
+    @param  y      The y position, starting with 0 for top-most side.
+    @param  color  Packed RGB color, 0x00RRGGBB (e.g. from Color() or
+                   ColorHSV()), regardless of LED color order.
   */
-  void setBrightness(uint8_t b) { _brightness = b + 1; }
+  void setPixelColor(int16_t x, int16_t y, uint32_t color) {
+    if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
+      _IS31_ROTATE_(x, y); // Handle GFX-style soft rotation
+      setRGB(x, y, color >> 16, color >> 8, color);
+    }
+  }
 
 protected:
-  uint16_t _brightness = 256; ///< Internally 1-256 for math
-  void *parent;               ///< Pointer back to EyeLights object
-  const uint16_t *ring_map;   ///< Pointer to LED index lookup table
-};
-
-/**************************************************************************/
-/*!
-    @brief  Class for direct (unbuffered) EyeLights LED ring, left or right.
-*/
-/**************************************************************************/
-class Adafruit_EyeLights_Ring : public Adafruit_EyeLights_Ring_Base {
-public:
   /*!
-    @brief  Constructor for one of the EyeLights ring objects (direct,
-            unbuffered). Used internally by the library, not user code.
-    @param  parent   Pointer to parent Adafruit_EyeLights object.
-    @param  isRight  true = right ring, false = left ring.
+    @brief  Set the LEDs of one pixel. No clipping or rotation; unmapped
+            pixels are skipped.
+    @param  x  Unrotated column, 0 to Layout::width-1.
+    @param  y  Unrotated row, 0 to Layout::height-1.
+    @param  r  Red brightness, 0 to 255.
+    @param  g  Green brightness, 0 to 255.
+    @param  b  Blue brightness, 0 to 255.
   */
-  Adafruit_EyeLights_Ring(void *parent, bool isRight)
-      : Adafruit_EyeLights_Ring_Base(parent, isRight) {}
-  void setPixelColor(int16_t n, uint32_t color);
-  void setPixelColor(int16_t n, uint8_t t, uint8_t g, uint8_t b);
-  void fill(uint32_t color);
-  void fill(uint8_t r, uint8_t g, uint8_t b);
-};
-
-/**************************************************************************/
-/*!
-    @brief  Class for buffered EyeLights LED ring, left or right.
-*/
-/**************************************************************************/
-class Adafruit_EyeLights_Ring_buffered : public Adafruit_EyeLights_Ring_Base {
-public:
+  void setRGB(uint8_t x, uint8_t y, uint8_t r, uint8_t g, uint8_t b) {
+    uint16_t ridx = Layout::led(x, y, rOffset);
+    if (!Layout::sparse || (ridx < 351)) { // Skip unmapped pixels
+      beginBatch(); // Usually adjacent LEDs, send as one transfer
+      setLEDPWM(ridx, r);
+      setLEDPWM(Layout::led(x, y, gOffset), g);
+      setLEDPWM(Layout::led(x, y, bOffset), b);
+      endBatch();
+    }
+  }
   /*!
-    @brief  Constructor for one of the EyeLights ring objects (buffered).
-            Used internally by the library, not user code.
-    @param  parent   Pointer to parent Adafruit_EyeLights_buffered object.
-    @param  isRight  true = right ring, false = left ring.
+    @brief  Look up R,G,B LED indices for one pixel, for scaleCanvas().
+    @param  pixmap  Table from Adafruit_IS31FL3741_Canvas_Base::ledMap(),
+                    or NULL to use the layout's tables directly (slower).
+    @param  x       Horizontal pixel position.
+    @param  y       Vertical pixel position.
+    @param  idx     Pointer to 3 LED indices for result; 65535 if unmapped.
   */
-  Adafruit_EyeLights_Ring_buffered(void *parent, bool isRight)
-      : Adafruit_EyeLights_Ring_Base(parent, isRight) {}
-  void setPixelColor(int16_t n, uint32_t color);
-  void setPixelColor(int16_t n, uint8_t r, uint8_t g, uint8_t b);
-  void fill(uint32_t color);
-  void fill(uint8_t r, uint8_t g, uint8_t b);
+  void pixelLEDs(const uint16_t *pixmap, uint8_t x, uint8_t y,
+                 uint16_t *idx) const {
+    if (pixmap) {
+      memcpy(idx, &pixmap[(y * Layout::width + x) * 3], 3 * sizeof(uint16_t));
+    } else {
+      idx[0] = Layout::led(x, y, rOffset);
+      idx[1] = Layout::led(x, y, gOffset);
+      idx[2] = Layout::led(x, y, bOffset);
+    }
+  }
+  /*!
+    @brief  Scale a 3X size canvas of any supported depth 1:3 to the matrix
+            with antialiasing and gamma correction; common code for the
+            scaleCanvas() variants. Canvas size is checked at run time;
+            if it's not 3X the matrix, nothing happens.
+    @param  src      Pointer to GFXcanvas16, GFXcanvas8 or GFXcanvas1, or
+                     NULL to do nothing.
+    @param  aux      Palette for GFXcanvas8, levels from
+                     IS3741_downsample::monoLevels() for GFXcanvas1,
+                     ignored for GFXcanvas16.
+    @param  pixmap   Pointer to R,G,B LED indices per pixel, row-major, as
+                     from Adafruit_IS31FL3741_Canvas_Base::ledMap(), or
+                     NULL to use the layout's tables directly (slower).
+    @param  tracked  Same canvas if it's an
+                     Adafruit_IS31FL3741_TrackedCanvas, in which case only
+                     changed blocks are processed, else NULL.
+  */
+  template <class Canvas, class Aux>
+  void scaleBlocks(const Canvas *src, const Aux *aux, const uint16_t *pixmap,
+                   Adafruit_IS31FL3741_TrackedCanvas *tracked) {
+    if (src &&
+        IS3741_downsample::canvasFits(src, Layout::width, Layout::height)) {
+      beginBatch();
+      uint32_t rgb[Layout::width]; // One output row, packed R,G,B bytes
+      for (uint8_t y = 0; y < Layout::height; y++) {
+        uint8_t x0 = 0, x1 = Layout::width; // Span of blocks to process
+        if (tracked) {
+          while ((x0 < x1) && !tracked->isDirty(x0, y))
+            x0++;
+          while ((x1 > x0) && !tracked->isDirty(x1 - 1, y))
+            x1--;
+        }
+        if (x0 < x1) {
+          IS3741_downsample::scaleRow(src, aux, Layout::width, y, x0,
+                                      x1 - x0, rgb);
+          for (uint8_t x = x0; x < x1; x++) {
+            if (!tracked || tracked->isDirty(x, y)) {
+              uint16_t idx[3];
+              pixelLEDs(pixmap, x, y, idx);
+              if (idx[0] < 351) { // Skip unmapped pixels
+                uint32_t c = rgb[x - x0];
+                setLEDPWM(idx[0], c);
+                setLEDPWM(idx[1], c >> 8);
+                setLEDPWM(idx[2], c >> 16);
+              }
+            }
+          }
+        }
+      }
+      endBatch();
+      if (tracked)
+        tracked->clean();
+    }
+  }
+  /*!
+    @brief  Scale a 3X size canvas 1:3 to the matrix with antialiasing and
+            gamma correction, overwriting all matrix pixels; used by the
+            board classes' scale() functions, not directly.
+    @param  canvas   Pointer to GFXcanvas16, Layout::width * 3 by
+                     Layout::height * 3 pixels, or NULL to do nothing.
+    @param  pixmap   LED table from ledMap(), or NULL.
+    @param  tracked  Same canvas if it's an
+                     Adafruit_IS31FL3741_TrackedCanvas, else NULL (default).
+  */
+  void scaleCanvas(const GFXcanvas16 *canvas, const uint16_t *pixmap,
+                   Adafruit_IS31FL3741_TrackedCanvas *tracked = NULL) {
+    scaleBlocks(canvas, (const uint16_t *)NULL, pixmap, tracked);
+  }
+  /*!
+    @brief  Scale a 3X size palette-indexed canvas 1:3 to the matrix with
+            antialiasing and gamma correction, overwriting all matrix
+            pixels; used by the board classes' scale() functions.
+    @param  canvas   Pointer to GFXcanvas8, Layout::width * 3 by
+                     Layout::height * 3 pixels, or NULL to do nothing.
+    @param  palette  RGB565 color for each index used in the canvas.
+    @param  pixmap   LED table from ledMap(), or NULL.
+  */
+  void scaleCanvas(const GFXcanvas8 *canvas, const uint16_t *palette,
+                   const uint16_t *pixmap) {
+    if (palette)
+      scaleBlocks(canvas, palette, pixmap, NULL);
+  }
+  /*!
+    @brief  Scale a 3X size 1-bit canvas 1:3 to the matrix with
+            antialiasing and gamma correction, overwriting all matrix
+            pixels; used by the board classes' scale() functions.
+    @param  canvas  Pointer to GFXcanvas1, Layout::width * 3 by
+                    Layout::height * 3 pixels, or NULL to do nothing.
+    @param  fg      RGB565 color for set bits.
+    @param  bg      RGB565 color for clear bits.
+    @param  pixmap  LED table from ledMap(), or NULL.
+  */
+  void scaleCanvas(const GFXcanvas1 *canvas, uint16_t fg, uint16_t bg,
+                   const uint16_t *pixmap) {
+    uint32_t levels[10]; // Color for 0 to 9 bits set in a 3x3 block
+    IS3741_downsample::monoLevels(fg, bg, levels);
+    scaleBlocks(canvas, levels, pixmap, NULL);
+  }
 };
 
 /**************************************************************************/
 /*!
-    @brief  Base class for EyeLights LED glasses. Holds a few items that
-            are common to direct or buffered instances.
+    @brief  Class template for an RGB LED matrix board, buffered. As with
+            the direct version, the Layout struct supplies dimensions and
+            pixel mapping.
 */
 /**************************************************************************/
-class Adafruit_EyeLights_Base {
+template <class Layout>
+class Adafruit_IS31FL3741_Matrix_buffered
+    : public Adafruit_IS31FL3741_colorGFX_buffered {
 public:
   /*!
-    @brief  Constructor for Adafruit_EyeLights_Base object. This is used
+    @brief  Constructor for matrix board, buffered. This is used
             internally by the library, not user code.
-    @param  withCanvas  true to also allocate a 3X size GFXcanvas16 object
-                        (can be used for antialiasing via the smooth()
-                        function), false for normal direct-to-matrix drawing.
+    @param  order  One of the IS3741_order enumeration types for RGB
+                   sequence.
   */
-  Adafruit_EyeLights_Base(bool withCanvas) {
-    if (withCanvas)
-      canvas = new GFXcanvas16(18 * 3, 5 * 3);
-  }
+  Adafruit_IS31FL3741_Matrix_buffered(IS3741_order order)
+      : Adafruit_IS31FL3741_colorGFX_buffered(Layout::width, Layout::height,
+                                              order) {}
   /*!
-    @brief    Get pointer to GFX canvas for smooth drawing.
-    @returns  GFXcanvas16*  Pointer to GFXcanvas16 object, or NULL.
+    @brief  Set all pixels to one color. No immediate effect on LEDs; must
+            follow up with show(). Black and white are set with a single
+            memset() over ALL LEDs (including e.g. EyeLights ring-only
+            LEDs, as in prior versions of this library). Other colors are
+            written with a single pass over the LED buffer using the
+            layout's slot() table, leaving LEDs outside the matrix alone.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void fill(uint16_t color = 0) {
+    if ((color == 0) || (color == 0xFFFF)) { // Black or white
+      memset(&ledbuf[1], color & 0xFF, 351);
+      markDirty();
+    } else {
+      _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
+      uint8_t val[4]; // LED value for each slot() 0-2
+      val[rOffset] = r;
+      val[gOffset] = g;
+      val[bOffset] = b;
+      uint8_t *ptr = &ledbuf[1]; // Not getBuffer(), that flags ALL LEDs
+      for (uint16_t led = 0; led < 351; led++) {
+        uint8_t s = Layout::slot(led);
+        if (s < 3) {
+          ptr[led] = val[s];
+          if (Layout::sparse)
+            markDirty(led);
+        }
+      }
+      if (!Layout::sparse) // Every LED was set
+        markDirty();
+    }
+  }
+  /*!
+    @brief  Adafruit GFX low level accessor - sets an RGB pixel value,
+            handles rotation and pixel arrangement. No immediate effect
+            on LEDs; must follow up with show().
+    @param  x      The x position, starting with 0 for left-most side.
+    @param  y      The y position, starting with 0 for top-most side.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
+      _IS31_ROTATE_(x, y);           // Handle GFX-style soft rotation
+      _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
+      setRGB(x, y, r, g, b);
+    }
+  }
+  /*!
+    @brief  Adafruit GFX per-pixel write used by lines, bitmaps and text.
+            Overrides the default, which makes a second virtual call to
+            drawPixel(), with a direct call to this class's drawPixel().
+    @param  x      The x position, starting with 0 for left-most side.
+    @param  y      The y position, starting with 0 for top-most side.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void writePixel(int16_t x, int16_t y, uint16_t color) {
+    Adafruit_IS31FL3741_Matrix_buffered::drawPixel(x, y, color);
+  }
+  /*!
+    @brief  Fill a rectangle with one color. Overrides Adafruit_GFX's
+            pixel-at-a-time version (also used by fillScreen() and for
+            scaled text), clipping, rotating and expanding the color just
+            once for the whole rectangle. No immediate effect on LEDs;
+            must follow up with show().
+    @param  x      Top-left corner X coordinate.
+    @param  y      Top-left corner Y coordinate.
+    @param  w      Width in pixels.
+    @param  h      Height in pixels.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w < 0) { // Negative sizes extend left/up from x/y
+      x += w + 1;
+      w = -w;
+    }
+    if (h < 0) {
+      y += h + 1;
+      h = -h;
+    }
+    if (x < 0) { // Clip to matrix
+      w += x;
+      x = 0;
+    }
+    if (y < 0) {
+      h += y;
+      y = 0;
+    }
+    if (w > (width() - x))
+      w = width() - x;
+    if (h > (height() - y))
+      h = height() - y;
+    if ((w <= 0) || (h <= 0))
+      return;
+
+    int8_t cx, cy, rx, ry;
+    getSteps(cx, cy, rx, ry);
+    _IS31_ROTATE_(x, y);           // Unrotated top-left corner
+    _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
+    for (; h--; x += rx, y += ry) {
+      int16_t px = x, py = y;
+      for (int16_t i = w; i--; px += cx, py += cy)
+        setRGB(px, py, r, g, b);
+    }
+  }
+  /*!
+    @brief  Draw a horizontal line, via fillRect(). No immediate effect on
+            LEDs; must follow up with show().
+    @param  x      Left-most X coordinate.
+    @param  y      Y coordinate.
+    @param  w      Width in pixels.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    fillRect(x, y, w, 1, color);
+  }
+  /*!
+    @brief  Draw a vertical line, via fillRect(). No immediate effect on
+            LEDs; must follow up with show().
+    @param  x      X coordinate.
+    @param  y      Top-most Y coordinate.
+    @param  h      Height in pixels.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    fillRect(x, y, 1, h, color);
+  }
+  /*!
+    @brief  Set a pixel from a packed 24-bit RGB color, at full precision
+            (vs drawPixel(), where RGB565 loses some low bits). Handles
+            rotation and pixel arrangement. No immediate effect on LEDs;
+            must follow up with show().
+    @param  x      The x position, starting with 0 for left-most side.
+    @param  y      The y position, starting with 0 for top-most side.
+    @param  color  Packed RGB color, 0x00RRGGBB (e.g. from Color() or
+                   ColorHSV()), regardless of LED color order.
+  */
+  void setPixelColor(int16_t x, int16_t y, uint32_t color) {
+    if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
+      _IS31_ROTATE_(x, y); // Handle GFX-style soft rotation
+      setRGB(x, y, color >> 16, color >> 8, color);
+    }
+  }
+  /*!
+    @brief  Copy a full frame of 24-bit RGB pixels into the LED buffer in
+            one pass, handling rotation and pixel arrangement. No
+            immediate effect on LEDs; must follow up with show().
+    @param  src     Pointer to frame: width() x height() pixels (as rotated)
+                    of 3 bytes each, in R,G,B order regardless of LED color
+                    order, starting at top-left.
+    @param  stride  Bytes from start of one row to the next, if rows are
+                    padded or the frame is part of a larger image. Default
+                    of 0 means tightly packed (width() * 3).
+  */
+  void blitRGB888(const uint8_t *src, uint16_t stride = 0) {
+    if (!stride)
+      stride = width() * 3;
+    int8_t cx, cy, rx, ry;
+    getSteps(cx, cy, rx, ry);
+    int16_t x = 0, y = 0;
+    _IS31_ROTATE_(x, y); // Unrotated top-left corner
+    for (int16_t h = height(); h--; src += stride, x += rx, y += ry) {
+      const uint8_t *ptr = src;
+      int16_t px = x, py = y;
+      for (int16_t w = width(); w--; ptr += 3, px += cx, py += cy)
+        setRGB(px, py, ptr[0], ptr[1], ptr[2]);
+    }
+  }
+  using Adafruit_GFX::drawRGBBitmap; // Keep masked versions visible
+  /*!
+    @brief  Draw a PROGMEM-resident RGB565 bitmap, overriding Adafruit_GFX's
+            pixel-at-a-time version. Clipping and rotation are handled
+            once for the whole bitmap. No immediate effect on LEDs; must
+            follow up with show().
+    @param  x       Top-left corner X coordinate.
+    @param  y       Top-left corner Y coordinate.
+    @param  bitmap  Bitmap, w * h RGB565 pixels, in PROGMEM.
+    @param  w       Bitmap width in pixels.
+    @param  h       Bitmap height in pixels.
+  */
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w,
+                     int16_t h) {
+    blit565(x, y, bitmap, w, h, true);
+  }
+  /*!
+    @brief  Draw a RAM-resident RGB565 bitmap (e.g. a GFXcanvas16 buffer),
+            overriding Adafruit_GFX's pixel-at-a-time version. Clipping
+            and rotation are handled once for the whole bitmap. No
+            immediate effect on LEDs; must follow up with show().
+    @param  x       Top-left corner X coordinate.
+    @param  y       Top-left corner Y coordinate.
+    @param  bitmap  Bitmap, w * h RGB565 pixels, in RAM.
+    @param  w       Bitmap width in pixels.
+    @param  h       Bitmap height in pixels.
+  */
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w,
+                     int16_t h) {
+    blit565(x, y, bitmap, w, h, false);
+  }
+
+protected:
+  /*!
+    @brief  Clip and draw an RGB565 bitmap; used by the drawRGBBitmap()
+            functions, not directly.
+    @param  x        Top-left corner X coordinate.
+    @param  y        Top-left corner Y coordinate.
+    @param  bitmap   Bitmap, w * h RGB565 pixels.
+    @param  w        Bitmap width in pixels.
+    @param  h        Bitmap height in pixels.
+    @param  progmem  true if bitmap is in PROGMEM, false if RAM.
+  */
+  void blit565(int16_t x, int16_t y, const uint16_t *bitmap, int16_t w,
+               int16_t h, bool progmem) {
+    int16_t stride = w;
+    if (x < 0) { // Clip to matrix
+      bitmap -= x;
+      w += x;
+      x = 0;
+    }
+    if (y < 0) {
+      bitmap -= y * stride;
+      h += y;
+      y = 0;
+    }
+    if (w > (width() - x))
+      w = width() - x;
+    if (h > (height() - y))
+      h = height() - y;
+    if ((w <= 0) || (h <= 0))
+      return;
+
+    int8_t cx, cy, rx, ry;
+    getSteps(cx, cy, rx, ry);
+    _IS31_ROTATE_(x, y); // Unrotated top-left corner
+    for (; h--; bitmap += stride, x += rx, y += ry) {
+      int16_t px = x, py = y;
+      for (int16_t i = 0; i < w; i++, px += cx, py += cy) {
+        uint16_t color = progmem ? pgm_read_word(&bitmap[i]) : bitmap[i];
+        _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
+        setRGB(px, py, r, g, b);
+      }
+    }
+  }
+  /*!
+    @brief  Get the unrotated steps for walking the matrix in rotated
+            (GFX) coordinates: one pixel right is (cx, cy), one row down
+            is (rx, ry).
+    @param  cx  Unrotated X step per pixel, -1 to 1 (returned).
+    @param  cy  Unrotated Y step per pixel, -1 to 1 (returned).
+    @param  rx  Unrotated X step per row, -1 to 1 (returned).
+    @param  ry  Unrotated Y step per row, -1 to 1 (returned).
+  */
+  void getSteps(int8_t &cx, int8_t &cy, int8_t &rx, int8_t &ry) {
+    switch (getRotation()) {
+    case 1:
+      cx = 0, cy = 1, rx = -1, ry = 0;
+      break;
+    case 2:
+      cx = -1, cy = 0, rx = 0, ry = -1;
+      break;
+    case 3:
+      cx = 0, cy = -1, rx = 1, ry = 0;
+      break;
+    default:
+      cx = 1, cy = 0, rx = 0, ry = 1;
+      break;
+    }
+  }
+  /*!
+    @brief  Set the LEDs of one pixel in the buffer and flag them as
+            changed. No clipping or rotation; unmapped pixels are skipped.
+    @param  x  Unrotated column, 0 to Layout::width-1.
+    @param  y  Unrotated row, 0 to Layout::height-1.
+    @param  r  Red brightness, 0 to 255.
+    @param  g  Green brightness, 0 to 255.
+    @param  b  Blue brightness, 0 to 255.
+  */
+  void setRGB(uint8_t x, uint8_t y, uint8_t r, uint8_t g, uint8_t b) {
+    uint16_t ridx = Layout::led(x, y, rOffset);
+    if (!Layout::sparse || (ridx < 351)) { // Skip unmapped pixels
+      uint16_t gidx = Layout::led(x, y, gOffset);
+      uint16_t bidx = Layout::led(x, y, bOffset);
+      ledbuf[1 + ridx] = r; // +1 because not using getBuffer(),
+      ledbuf[1 + gidx] = g; // that would flag ALL LEDs changed
+      ledbuf[1 + bidx] = b;
+      markDirty(ridx);
+      markDirty(gidx);
+      markDirty(bidx);
+    }
+  }
+  /*!
+    @brief  Look up R,G,B LED indices for one pixel, for scaleCanvas().
+    @param  pixmap  Table from Adafruit_IS31FL3741_Canvas_Base::ledMap(),
+                    or NULL to use the layout's tables directly (slower).
+    @param  x       Horizontal pixel position.
+    @param  y       Vertical pixel position.
+    @param  idx     Pointer to 3 LED indices for result; 65535 if unmapped.
+  */
+  void pixelLEDs(const uint16_t *pixmap, uint8_t x, uint8_t y,
+                 uint16_t *idx) const {
+    if (pixmap) {
+      memcpy(idx, &pixmap[(y * Layout::width + x) * 3], 3 * sizeof(uint16_t));
+    } else {
+      idx[0] = Layout::led(x, y, rOffset);
+      idx[1] = Layout::led(x, y, gOffset);
+      idx[2] = Layout::led(x, y, bOffset);
+    }
+  }
+  /*!
+    @brief  Scale a 3X size canvas of any supported depth 1:3 to the matrix
+            with antialiasing and gamma correction; common code for the
+            scaleCanvas() variants. Canvas size is checked at run time;
+            if it's not 3X the matrix, nothing happens.
+    @param  src      Pointer to GFXcanvas16, GFXcanvas8 or GFXcanvas1, or
+                     NULL to do nothing.
+    @param  aux      Palette for GFXcanvas8, levels from
+                     IS3741_downsample::monoLevels() for GFXcanvas1,
+                     ignored for GFXcanvas16.
+    @param  pixmap   Pointer to R,G,B LED indices per pixel, row-major, as
+                     from Adafruit_IS31FL3741_Canvas_Base::ledMap(), or
+                     NULL to use the layout's tables directly (slower).
+    @param  tracked  Same canvas if it's an
+                     Adafruit_IS31FL3741_TrackedCanvas, in which case only
+                     changed blocks are processed, else NULL.
+  */
+  template <class Canvas, class Aux>
+  void scaleBlocks(const Canvas *src, const Aux *aux, const uint16_t *pixmap,
+                   Adafruit_IS31FL3741_TrackedCanvas *tracked) {
+    if (src &&
+        IS3741_downsample::canvasFits(src, Layout::width, Layout::height)) {
+      uint32_t rgb[Layout::width]; // One output row, packed R,G,B bytes
+      for (uint8_t y = 0; y < Layout::height; y++) {
+        uint8_t x0 = 0, x1 = Layout::width; // Span of blocks to process
+        if (tracked) {
+          while ((x0 < x1) && !tracked->isDirty(x0, y))
+            x0++;
+          while ((x1 > x0) && !tracked->isDirty(x1 - 1, y))
+            x1--;
+        }
+        if (x0 < x1) {
+          IS3741_downsample::scaleRow(src, aux, Layout::width, y, x0,
+                                      x1 - x0, rgb);
+          for (uint8_t x = x0; x < x1; x++) {
+            if (!tracked || tracked->isDirty(x, y)) {
+              uint16_t idx[3];
+              pixelLEDs(pixmap, x, y, idx);
+              if (idx[0] < 351) { // Skip unmapped pixels
+                uint32_t c = rgb[x - x0];
+                // +1 because not using getBuffer(), that flags ALL LEDs
+                ledbuf[1 + idx[0]] = c;
+                ledbuf[1 + idx[1]] = c >> 8;
+                ledbuf[1 + idx[2]] = c >> 16;
+                markDirty(idx[0]);
+                markDirty(idx[1]);
+                markDirty(idx[2]);
+              }
+            }
+          }
+        }
+      }
+      if (tracked)
+        tracked->clean();
+    }
+  }
+  /*!
+    @brief  Scale a 3X size canvas 1:3 to the matrix with antialiasing and
+            gamma correction, overwriting all matrix pixels; used by the
+            board classes' scale() functions, not directly. No immediate
+            effect on LEDs; must follow up with show().
+    @param  canvas   Pointer to GFXcanvas16, Layout::width * 3 by
+                     Layout::height * 3 pixels, or NULL to do nothing.
+    @param  pixmap   LED table from ledMap(), or NULL.
+    @param  tracked  Same canvas if it's an
+                     Adafruit_IS31FL3741_TrackedCanvas, else NULL (default).
+  */
+  void scaleCanvas(const GFXcanvas16 *canvas, const uint16_t *pixmap,
+                   Adafruit_IS31FL3741_TrackedCanvas *tracked = NULL) {
+    scaleBlocks(canvas, (const uint16_t *)NULL, pixmap, tracked);
+  }
+  /*!
+    @brief  Scale a 3X size palette-indexed canvas 1:3 to the matrix with
+            antialiasing and gamma correction, overwriting all matrix
+            pixels; used by the board classes' scale() functions. No immediate
+            effect on LEDs; must follow up with show().
+    @param  canvas   Pointer to GFXcanvas8, Layout::width * 3 by
+                     Layout::height * 3 pixels, or NULL to do nothing.
+    @param  palette  RGB565 color for each index used in the canvas.
+    @param  pixmap   LED table from ledMap(), or NULL.
+  */
+  void scaleCanvas(const GFXcanvas8 *canvas, const uint16_t *palette,
+                   const uint16_t *pixmap) {
+    if (palette)
+      scaleBlocks(canvas, palette, pixmap, NULL);
+  }
+  /*!
+    @brief  Scale a 3X size 1-bit canvas 1:3 to the matrix with
+            antialiasing and gamma correction, overwriting all matrix
+            pixels; used by the board classes' scale() functions. No immediate
+            effect on LEDs; must follow up with show().
+    @param  canvas  Pointer to GFXcanvas1, Layout::width * 3 by
+                    Layout::height * 3 pixels, or NULL to do nothing.
+    @param  fg      RGB565 color for set bits.
+    @param  bg      RGB565 color for clear bits.
+    @param  pixmap  LED table from ledMap(), or NULL.
+  */
+  void scaleCanvas(const GFXcanvas1 *canvas, uint16_t fg, uint16_t bg,
+                   const uint16_t *pixmap) {
+    uint32_t levels[10]; // Color for 0 to 9 bits set in a 3x3 block
+    IS3741_downsample::monoLevels(fg, bg, levels);
+    scaleBlocks(canvas, levels, pixmap, NULL);
+  }
+  /*!
+    @brief    Identify an LED's color for show-time color correction,
+              from the layout's slot() table and color order.
+    @param    led  LED index, 0 to 350.
+    @returns  0 for red, 1 for green, 2 for blue, 3 if not in matrix.
+  */
+  uint8_t ledChannel(uint16_t led) {
+    uint8_t s = Layout::slot(led);
+    return (s == rOffset) ? 0 : (s == gOffset) ? 1 : (s == bOffset) ? 2 : 3;
+  }
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class template for an RGB LED matrix board with 16 bits per
+            LED, buffered. The chip's PWM is only 8 bits, so show()
+            reduces each LED to 8 bits by temporal dithering: the part
+            that doesn't fit is carried over to the next show(), so with
+            frequent show() calls, in-between levels are rendered by
+            alternating between neighboring steps. This mostly helps dim
+            colors and slow fades, where 8-bit values (especially after
+            gamma correction) leave visibly large steps. Values are linear
+            (proportional to PWM duty cycle), so any gamma correction
+            should be done at 16 bits before setting them. Only LEDs whose
+            8-bit value changes are sent. Uses about 1 KB more RAM than the
+            regular buffered classes, too much for the likes of Arduino
+            Uno.
+*/
+/**************************************************************************/
+template <class Layout>
+class Adafruit_IS31FL3741_Matrix_dithered
+    : public Adafruit_IS31FL3741_colorGFX_buffered {
+public:
+  /*!
+    @brief  Constructor for matrix board, 16-bit buffered. This is used
+            internally by the library, not user code.
+    @param  order  One of the IS3741_order enumeration types for RGB
+                   sequence.
+  */
+  Adafruit_IS31FL3741_Matrix_dithered(IS3741_order order)
+      : Adafruit_IS31FL3741_colorGFX_buffered(Layout::width, Layout::height,
+                                              order) {}
+  /*!
+    @brief    Initialize I2C and IS31FL3741 hardware, clear LED buffers.
+    @param    addr     I2C address where we expect to find the chip.
+    @param    theWire  Pointer to TwoWire I2C bus to use, defaults to &Wire.
+    @returns  true on success, false if chip isn't found.
+  */
+  bool begin(uint8_t addr = IS3741_ADDR_DEFAULT, TwoWire *theWire = &Wire) {
+    bool status = Adafruit_IS31FL3741_buffered::begin(addr, theWire);
+    if (status) {
+      memset(buf16, 0, sizeof buf16);
+      // Stagger the carried-over amounts, so LEDs at the same in-between
+      // level don't all alternate in step (less apparent flicker).
+      for (uint16_t led = 0; led < 351; led++)
+        err[led] = led * 151;
+    }
+    return status;
+  }
+  /*!
+    @brief  Dither the 16-bit buffer down to 8 bits and push changes to
+            the device. For smooth results, call this frequently even if
+            nothing's changed (that's when dithering happens).
+  */
+  void show(void) {
+    dither();
+    Adafruit_IS31FL3741_buffered::show();
+  }
+  /*!
+    @brief    As with show(), but using showAsync() for the transfer.
+    @returns  true if transfer was started, false if it was done
+              immediately (see Adafruit_IS31FL3741_buffered::showAsync()).
+  */
+  bool showAsync(void) {
+    dither();
+    return Adafruit_IS31FL3741_buffered::showAsync();
+  }
+  /*!
+    @brief    Return address of 16-bit LED buffer, in LED index order
+              (unlike getBuffer(), there's no extra leading element). The
+              8-bit getBuffer() is overwritten on each show() and isn't
+              useful with this class.
+    @returns  uint16_t*  Pointer to first LED's 16-bit value.
+  */
+  uint16_t *getBuffer16(void) { return buf16; }
+  /*!
+    @brief  Set one LED's 16-bit value. No immediate effect on LEDs; must
+            follow up with show().
+    @param  lednum  LED index, 0 to 350. Out-of-range values are ignored.
+    @param  value   Linear brightness, 0 to 65535.
+  */
+  void setLED16(uint16_t lednum, uint16_t value) {
+    if (lednum < 351)
+      buf16[lednum] = value;
+  }
+  /*!
+    @brief  Set all pixels to one color. No immediate effect on LEDs; must
+            follow up with show().
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void fill(uint16_t color = 0) {
+    _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
+    fill16(r << 8, g << 8, b << 8); // Same levels as 8-bit classes
+  }
+  /*!
+    @brief  Set all pixels to one 16-bit-per-channel color. LEDs that
+            aren't part of the matrix are left untouched. No immediate
+            effect on LEDs; must follow up with show().
+    @param  r  Red brightness, 0 to 65535.
+    @param  g  Green brightness, 0 to 65535.
+    @param  b  Blue brightness, 0 to 65535.
+  */
+  void fill16(uint16_t r, uint16_t g, uint16_t b) {
+    uint16_t val[4]; // LED value for each slot() 0-2
+    val[rOffset] = r;
+    val[gOffset] = g;
+    val[bOffset] = b;
+    for (uint16_t led = 0; led < 351; led++) {
+      uint8_t s = Layout::slot(led);
+      if (s < 3)
+        buf16[led] = val[s];
+    }
+  }
+  /*!
+    @brief  Adafruit GFX low level accessor - sets an RGB pixel value,
+            handles rotation and pixel arrangement. No immediate effect
+            on LEDs; must follow up with show().
+    @param  x      The x position, starting with 0 for left-most side.
+    @param  y      The y position, starting with 0 for top-most side.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
+      _IS31_ROTATE_(x, y);           // Handle GFX-style soft rotation
+      _IS31_EXPAND_(color, r, g, b); // Expand GFX's RGB565 color to RGB888
+      setRGB16(x, y, r << 8, g << 8, b << 8);
+    }
+  }
+  /*!
+    @brief  Adafruit GFX per-pixel write used by lines, bitmaps and text.
+            Overrides the default, which makes a second virtual call to
+            drawPixel(), with a direct call to this class's drawPixel().
+    @param  x      The x position, starting with 0 for left-most side.
+    @param  y      The y position, starting with 0 for top-most side.
+    @param  color  16-bit RGB565 packed color (expands to 888 for LEDs).
+  */
+  void writePixel(int16_t x, int16_t y, uint16_t color) {
+    Adafruit_IS31FL3741_Matrix_dithered::drawPixel(x, y, color);
+  }
+  /*!
+    @brief  Set a pixel from a packed 24-bit RGB color. Handles rotation
+            and pixel arrangement. No immediate effect on LEDs; must
+            follow up with show().
+    @param  x      The x position, starting with 0 for left-most side.
+    @param  y      The y position, starting with 0 for top-most side.
+    @param  color  Packed RGB color, 0x00RRGGBB, regardless of LED color
+                   order.
+  */
+  void setPixelColor(int16_t x, int16_t y, uint32_t color) {
+    setPixelColor16(x, y, (color >> 8) & 0xFF00, color & 0xFF00,
+                    (color << 8) & 0xFF00);
+  }
+  /*!
+    @brief  Set a pixel from 16-bit-per-channel values. Handles rotation
+            and pixel arrangement. No immediate effect on LEDs; must
+            follow up with show().
+    @param  x  The x position, starting with 0 for left-most side.
+    @param  y  The y position, starting with 0 for top-most side.
+    @param  r  Red brightness, 0 to 65535.
+    @param  g  Green brightness, 0 to 65535.
+    @param  b  Blue brightness, 0 to 65535.
+  */
+  void setPixelColor16(int16_t x, int16_t y, uint16_t r, uint16_t g,
+                       uint16_t b) {
+    if ((x >= 0) && (y >= 0) && (x < width()) && (y < height())) {
+      _IS31_ROTATE_(x, y); // Handle GFX-style soft rotation
+      setRGB16(x, y, r, g, b);
+    }
+  }
+
+protected:
+  /*!
+    @brief  Set the 16-bit values of one pixel. No clipping or rotation;
+            unmapped pixels are skipped.
+    @param  x  Unrotated column, 0 to Layout::width-1.
+    @param  y  Unrotated row, 0 to Layout::height-1.
+    @param  r  Red brightness, 0 to 65535.
+    @param  g  Green brightness, 0 to 65535.
+    @param  b  Blue brightness, 0 to 65535.
+  */
+  void setRGB16(uint8_t x, uint8_t y, uint16_t r, uint16_t g, uint16_t b) {
+    uint16_t ridx = Layout::led(x, y, rOffset);
+    if (!Layout::sparse || (ridx < 351)) { // Skip unmapped pixels
+      buf16[ridx] = r;
+      buf16[Layout::led(x, y, gOffset)] = g;
+      buf16[Layout::led(x, y, bOffset)] = b;
+    }
+  }
+  /*!
+    @brief  Reduce 16-bit buffer to 8-bit LED buffer, carrying each LED's
+            remainder over to the next call, and flag LEDs whose 8-bit
+            value changed.
+  */
+  void dither(void) {
+    uint8_t *ptr = &ledbuf[1]; // Not getBuffer(), that flags ALL LEDs
+    for (uint16_t led = 0; led < 351; led++) {
+      uint16_t v = buf16[led], sum = v + err[led];
+      if (sum < v) // Overflowed, i.e. fully on
+        sum = 0xFFFF;
+      err[led] = sum; // Low byte carries over
+      if (ptr[led] != (sum >> 8)) {
+        ptr[led] = sum >> 8;
+        markDirty(led);
+      }
+    }
+  }
+  /*!
+    @brief    Identify an LED's color for show-time color correction,
+              from the layout's slot() table and color order.
+    @param    led  LED index, 0 to 350.
+    @returns  0 for red, 1 for green, 2 for blue, 3 if not in matrix.
+  */
+  uint8_t ledChannel(uint16_t led) {
+    uint8_t s = Layout::slot(led);
+    return (s == rOffset) ? 0 : (s == gOffset) ? 1 : (s == bOffset) ? 2 : 3;
+  }
+
+  uint16_t buf16[351]; ///< 16-bit LED values, linear
+  uint8_t err[351];    ///< Per-LED remainder carried to next show()
+};
+
+/**************************************************************************/
+/*!
+    @brief  GFXcanvas16 with its pixel data (and the RAM LED table used by
+            scale()) inside the object rather than on the heap, so a global
+            instance is accounted for at link time and startup doesn't
+            depend on heap state. Pass one to a board class constructor in
+            place of withCanvas; a size other than 3X the matrix is caught
+            at compile time.
+*/
+/**************************************************************************/
+template <uint16_t W, uint16_t H>
+class Adafruit_IS31FL3741_StaticCanvas : public GFXcanvas16 {
+public:
+  /*!
+    @brief  Constructor for canvas with static storage, initially cleared.
+  */
+  Adafruit_IS31FL3741_StaticCanvas(void) : GFXcanvas16(W, H, false) {
+    memset(storage, 0, sizeof storage);
+    buffer = storage;
+  }
+  /*!
+    @brief    Get pointer to space for scale()'s LED table. Used by the
+              library, not user code.
+    @returns  uint16_t*  Pointer to (W / 3) * (H / 3) * 3 words.
+  */
+  uint16_t *getMapStorage(void) { return ledmap; }
+
+protected:
+  uint16_t storage[W * H];                ///< Pixel data
+  uint16_t ledmap[(W / 3) * (H / 3) * 3]; ///< R,G,B LED indices per pixel
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class template holding the optional 3X size canvas used for
+            antialiased drawing via the board classes' scale() functions.
+            Not used on its own, board classes reference this.
+
+            Each board class built on this has the same scale() overloads,
+            each downsampling a 3X size canvas 1:3 with antialiasing and
+            gamma correction:
+            - scale(): the canvas requested via the constructor, if any.
+              Overwrites all matrix pixels, or with a change-tracking
+              canvas, only those drawn to since the last call.
+            - scale(const GFXcanvas8 *src, const uint16_t *palette): a
+              caller-provided palette-indexed canvas, with an RGB565 color
+              for each index used. Half the RAM of the 16-bit canvas.
+            - scale(const GFXcanvas1 *src, uint16_t fg, uint16_t bg = 0):
+              a caller-provided 1-bit canvas, with RGB565 colors for set
+              and clear bits. 1/16 the RAM of the 16-bit canvas; good for
+              text.
+
+            A caller-provided canvas must be 3X the matrix size in its
+            unrotated orientation (e.g. 39x27 for a 13x9 matrix), else
+            scale() does nothing; it overwrites all matrix pixels. On
+            buffered boards, scale() has no immediate effect on LEDs; must
+            follow up with show().
+*/
+/**************************************************************************/
+template <class Layout> class Adafruit_IS31FL3741_Canvas_Base {
+public:
+  /*!
+    @brief  Constructor for canvas holder. This is used internally by the
+            library, not user code.
+    @param  withCanvas    true to allocate a GFXcanvas16 3X the size of
+                          the layout (e.g. 2,106 bytes for 13x9), plus
+                          scale()'s LED table (6 bytes per pixel), false
+                          for none.
+    @param  trackChanges  true to make that an
+                          Adafruit_IS31FL3741_TrackedCanvas, so scale()
+                          only processes changed areas. Implies withCanvas.
+  */
+  Adafruit_IS31FL3741_Canvas_Base(bool withCanvas, bool trackChanges = false) {
+    if (trackChanges)
+      canvas = tracked = new Adafruit_IS31FL3741_TrackedCanvas(
+          Layout::width * 3, Layout::height * 3);
+    else if (withCanvas)
+      canvas = new GFXcanvas16(Layout::width * 3, Layout::height * 3);
+    if (canvas) // If this fails, scale() uses the layout's tables instead
+      pixmap = (uint16_t *)malloc(Layout::width * Layout::height * 3 *
+                                  sizeof(uint16_t));
+  }
+  /*!
+    @brief  Constructor for canvas holder using a caller-provided canvas
+            with static storage, so nothing is heap-allocated. This is used
+            internally by the library, not user code.
+    @param  staticCanvas  Canvas object, which must be 3X the layout size
+                          (else compilation fails) and outlive this one.
+  */
+  template <uint16_t W, uint16_t H>
+  Adafruit_IS31FL3741_Canvas_Base(
+      Adafruit_IS31FL3741_StaticCanvas<W, H> &staticCanvas)
+      : canvas(&staticCanvas), pixmap(staticCanvas.getMapStorage()),
+        ownCanvas(false) {
+    static_assert((W == Layout::width * 3) && (H == Layout::height * 3),
+                  "Canvas must be 3X the matrix size");
+  }
+// The canvases deleted below are always of exactly the type deleted, so
+// GFXcanvas16's non-virtual destructor is not a problem
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdelete-non-virtual-dtor"
+  /*!
+    @brief  Destructor for canvas holder. Frees the canvas and LED table
+            if the constructor allocated them; a static canvas belongs to
+            the caller and is left alone.
+  */
+  ~Adafruit_IS31FL3741_Canvas_Base(void) {
+    if (ownCanvas) {
+      if (tracked) // GFXcanvas16's destructor isn't virtual
+        delete tracked;
+      else
+        delete canvas;
+      free(pixmap);
+    }
+  }
+#pragma GCC diagnostic pop
+  /*!
+    @brief  Not copyable; the object may own its canvas and LED table.
+  */
+  Adafruit_IS31FL3741_Canvas_Base(const Adafruit_IS31FL3741_Canvas_Base &) =
+      delete;
+  /*!
+    @brief  Not assignable, for the same reason as the copy constructor.
+  */
+  Adafruit_IS31FL3741_Canvas_Base &
+  operator=(const Adafruit_IS31FL3741_Canvas_Base &) = delete;
+  /*!
+    @brief    Get pointer to GFX canvas for smooth drawing.
+    @returns  GFXcanvas16*  Pointer to GFXcanvas16 object, or NULL.
   */
   GFXcanvas16 *getCanvas(void) const { return canvas; }
+  /*!
+    @brief    Get pointer to GFX canvas for smooth drawing, if it tracks
+              changes (for its markDirty() functions).
+    @returns  Adafruit_IS31FL3741_TrackedCanvas*  Pointer to canvas object,
+              or NULL if none or not tracked.
+  */
+  Adafruit_IS31FL3741_TrackedCanvas *getTrackedCanvas(void) const {
+    return tracked;
+  }
 
 protected:
+  /*!
+    @brief    Get RAM copy of the layout's R,G,B LED indices for each pixel
+              (row-major, 65535 if unmapped), so scale() needn't repeat
+              the PROGMEM table lookups every frame. Space is reserved
+              by the constructor; the table is filled on first use, and
+              again only if the color order changes.
+    @param    order  Color order of the matrix using the canvas.
+    @returns  const uint16_t*  Pointer to table, or NULL if no canvas or
+                               allocation failed.
+  */
+  const uint16_t *ledMap(const Adafruit_IS31FL3741_ColorOrder &order) {
+    uint8_t o = (order.rOffset << 4) | (order.gOffset << 2) | order.bOffset;
+    if (pixmap && (o != mapOrder)) {
+      uint16_t *ptr = pixmap;
+      for (uint8_t y = 0; y < Layout::height; y++) {
+        for (uint8_t x = 0; x < Layout::width; x++) {
+          *ptr++ = Layout::led(x, y, order.rOffset);
+          *ptr++ = Layout::led(x, y, order.gOffset);
+          *ptr++ = Layout::led(x, y, order.bOffset);
+        }
+      }
+      mapOrder = o;
+      if (tracked)
+        tracked->markDirty(); // LED assignments changed, redo all
+    }
+    return pixmap;
+  }
   GFXcanvas16 *canvas = NULL; ///< Pointer to GFX canvas
+  Adafruit_IS31FL3741_TrackedCanvas *tracked = NULL; ///< Same, if tracked
+  uint16_t *pixmap = NULL;    ///< R,G,B LED index per pixel, see ledMap()
+  uint8_t mapOrder = 0xFF;    ///< Color order pixmap was built for
+  bool ownCanvas = true;      ///< If set, canvas & pixmap freed on delete
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class for Lumissil IS31FL3741 OEM evaluation board, direct
+            (unbuffered).
+*/
+/**************************************************************************/
+class Adafruit_IS31FL3741_EVB
+    : public Adafruit_IS31FL3741_Matrix<IS3741_EVB_layout>,
+      public Adafruit_IS31FL3741_Canvas_Base<IS3741_EVB_layout> {
+public:
+  /*!
+    @brief  Constructor for Lumissil IS31FL3741 OEM evaluation board,
+            13x9 pixels, direct (unbuffered).
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+    @param  withCanvas    true to also allocate a 3X size GFXcanvas16
+                          object (can be used for antialiasing via the
+                          scale() function), false for normal
+                          direct-to-matrix drawing. Default is false.
+    @param  trackChanges  true to make the canvas track which areas are
+                          drawn to, so scale() only processes those (see
+                          Adafruit_IS31FL3741_TrackedCanvas). Implies
+                          withCanvas. Default is false.
+  */
+  Adafruit_IS31FL3741_EVB(IS3741_order order = IS3741_BGR,
+                          bool withCanvas = false, bool trackChanges = false)
+      : Adafruit_IS31FL3741_Matrix<IS3741_EVB_layout>(order),
+        Adafruit_IS31FL3741_Canvas_Base<IS3741_EVB_layout>(withCanvas,
+                                                           trackChanges) {}
+  /*!
+    @brief  Constructor with a caller-provided canvas, so nothing is
+            heap-allocated.
+    @param  staticCanvas  Adafruit_IS31FL3741_StaticCanvas object, which
+                          must be 3X the matrix size (checked at compile
+                          time) and outlive this one.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+  */
+  template <uint16_t W, uint16_t H>
+  Adafruit_IS31FL3741_EVB(Adafruit_IS31FL3741_StaticCanvas<W, H> &staticCanvas,
+                          IS3741_order order = IS3741_BGR)
+      : Adafruit_IS31FL3741_Matrix<IS3741_EVB_layout>(order),
+        Adafruit_IS31FL3741_Canvas_Base<IS3741_EVB_layout>(staticCanvas) {}
+  /*!
+    @brief  Scale own canvas; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(void) { scaleCanvas(canvas, ledMap(*this), tracked); }
+  /*!
+    @brief  Scale GFXcanvas8; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas8 *src, const uint16_t *palette) {
+    scaleCanvas(src, palette, ledMap(*this));
+  }
+  /*!
+    @brief  Scale GFXcanvas1; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas1 *src, uint16_t fg, uint16_t bg = 0) {
+    scaleCanvas(src, fg, bg, ledMap(*this));
+  }
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class for Lumissil IS31FL3741 OEM evaluation board, buffered.
+*/
+/**************************************************************************/
+class Adafruit_IS31FL3741_EVB_buffered
+    : public Adafruit_IS31FL3741_Matrix_buffered<IS3741_EVB_layout>,
+      public Adafruit_IS31FL3741_Canvas_Base<IS3741_EVB_layout> {
+public:
+  /*!
+    @brief  Constructor for Lumissil IS31FL3741 OEM evaluation board,
+            13x9 pixels, buffered.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+    @param  withCanvas    true to also allocate a 3X size GFXcanvas16
+                          object (can be used for antialiasing via the
+                          scale() function), false for normal
+                          direct-to-matrix drawing. Default is false.
+    @param  trackChanges  true to make the canvas track which areas are
+                          drawn to, so scale() only processes those (see
+                          Adafruit_IS31FL3741_TrackedCanvas). Implies
+                          withCanvas. Default is false.
+  */
+  Adafruit_IS31FL3741_EVB_buffered(IS3741_order order = IS3741_BGR,
+                                   bool withCanvas = false,
+                                   bool trackChanges = false)
+      : Adafruit_IS31FL3741_Matrix_buffered<IS3741_EVB_layout>(order),
+        Adafruit_IS31FL3741_Canvas_Base<IS3741_EVB_layout>(withCanvas,
+                                                           trackChanges) {}
+  /*!
+    @brief  Constructor with a caller-provided canvas, so nothing is
+            heap-allocated.
+    @param  staticCanvas  Adafruit_IS31FL3741_StaticCanvas object, which
+                          must be 3X the matrix size (checked at compile
+                          time) and outlive this one.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+  */
+  template <uint16_t W, uint16_t H>
+  Adafruit_IS31FL3741_EVB_buffered(
+      Adafruit_IS31FL3741_StaticCanvas<W, H> &staticCanvas,
+      IS3741_order order = IS3741_BGR)
+      : Adafruit_IS31FL3741_Matrix_buffered<IS3741_EVB_layout>(order),
+        Adafruit_IS31FL3741_Canvas_Base<IS3741_EVB_layout>(staticCanvas) {}
+  /*!
+    @brief  Scale own canvas; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(void) { scaleCanvas(canvas, ledMap(*this), tracked); }
+  /*!
+    @brief  Scale GFXcanvas8; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas8 *src, const uint16_t *palette) {
+    scaleCanvas(src, palette, ledMap(*this));
+  }
+  /*!
+    @brief  Scale GFXcanvas1; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas1 *src, uint16_t fg, uint16_t bg = 0) {
+    scaleCanvas(src, fg, bg, ledMap(*this));
+  }
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class for Lumissil IS31FL3741 OEM evaluation board, 16-bit
+            buffered with temporal dithering.
+*/
+/**************************************************************************/
+class Adafruit_IS31FL3741_EVB_dithered
+    : public Adafruit_IS31FL3741_Matrix_dithered<IS3741_EVB_layout> {
+public:
+  /*!
+    @brief  Constructor for Lumissil IS31FL3741 OEM evaluation board,
+            13x9 pixels, 16-bit buffered.
+    @param  order  One of the IS3741_order enumeration types for RGB
+                   sequence. Default is IS3741_BGR.
+  */
+  Adafruit_IS31FL3741_EVB_dithered(IS3741_order order = IS3741_BGR)
+      : Adafruit_IS31FL3741_Matrix_dithered<IS3741_EVB_layout>(order) {}
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class for IS31FL3741 Adafruit STEMMA QT board, direct
+            (unbuffered).
+*/
+/**************************************************************************/
+class Adafruit_IS31FL3741_QT
+    : public Adafruit_IS31FL3741_Matrix<IS3741_QT_layout>,
+      public Adafruit_IS31FL3741_Canvas_Base<IS3741_QT_layout> {
+public:
+  /*!
+    @brief  Constructor for STEMMA QT version (13 x 9 LEDs), direct
+            (unbuffered).
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+    @param  withCanvas    true to also allocate a 3X size GFXcanvas16
+                          object (can be used for antialiasing via the
+                          scale() function), false for normal
+                          direct-to-matrix drawing. Default is false.
+    @param  trackChanges  true to make the canvas track which areas are
+                          drawn to, so scale() only processes those (see
+                          Adafruit_IS31FL3741_TrackedCanvas). Implies
+                          withCanvas. Default is false.
+  */
+  Adafruit_IS31FL3741_QT(IS3741_order order = IS3741_BGR,
+                         bool withCanvas = false, bool trackChanges = false)
+      : Adafruit_IS31FL3741_Matrix<IS3741_QT_layout>(order),
+        Adafruit_IS31FL3741_Canvas_Base<IS3741_QT_layout>(withCanvas,
+                                                          trackChanges) {}
+  /*!
+    @brief  Constructor with a caller-provided canvas, so nothing is
+            heap-allocated.
+    @param  staticCanvas  Adafruit_IS31FL3741_StaticCanvas object, which
+                          must be 3X the matrix size (checked at compile
+                          time) and outlive this one.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+  */
+  template <uint16_t W, uint16_t H>
+  Adafruit_IS31FL3741_QT(Adafruit_IS31FL3741_StaticCanvas<W, H> &staticCanvas,
+                         IS3741_order order = IS3741_BGR)
+      : Adafruit_IS31FL3741_Matrix<IS3741_QT_layout>(order),
+        Adafruit_IS31FL3741_Canvas_Base<IS3741_QT_layout>(staticCanvas) {}
+  /*!
+    @brief  Scale own canvas; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(void) { scaleCanvas(canvas, ledMap(*this), tracked); }
+  /*!
+    @brief  Scale GFXcanvas8; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas8 *src, const uint16_t *palette) {
+    scaleCanvas(src, palette, ledMap(*this));
+  }
+  /*!
+    @brief  Scale GFXcanvas1; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas1 *src, uint16_t fg, uint16_t bg = 0) {
+    scaleCanvas(src, fg, bg, ledMap(*this));
+  }
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class for IS31FL3741 Adafruit STEMMA QT board, buffered.
+*/
+/**************************************************************************/
+class Adafruit_IS31FL3741_QT_buffered
+    : public Adafruit_IS31FL3741_Matrix_buffered<IS3741_QT_layout>,
+      public Adafruit_IS31FL3741_Canvas_Base<IS3741_QT_layout> {
+public:
+  /*!
+    @brief  Constructor for STEMMA QT version (13 x 9 LEDs), buffered.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+    @param  withCanvas    true to also allocate a 3X size GFXcanvas16
+                          object (can be used for antialiasing via the
+                          scale() function), false for normal
+                          direct-to-matrix drawing. Default is false.
+    @param  trackChanges  true to make the canvas track which areas are
+                          drawn to, so scale() only processes those (see
+                          Adafruit_IS31FL3741_TrackedCanvas). Implies
+                          withCanvas. Default is false.
+  */
+  Adafruit_IS31FL3741_QT_buffered(IS3741_order order = IS3741_BGR,
+                                  bool withCanvas = false,
+                                  bool trackChanges = false)
+      : Adafruit_IS31FL3741_Matrix_buffered<IS3741_QT_layout>(order),
+        Adafruit_IS31FL3741_Canvas_Base<IS3741_QT_layout>(withCanvas,
+                                                          trackChanges) {}
+  /*!
+    @brief  Constructor with a caller-provided canvas, so nothing is
+            heap-allocated.
+    @param  staticCanvas  Adafruit_IS31FL3741_StaticCanvas object, which
+                          must be 3X the matrix size (checked at compile
+                          time) and outlive this one.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+  */
+  template <uint16_t W, uint16_t H>
+  Adafruit_IS31FL3741_QT_buffered(
+      Adafruit_IS31FL3741_StaticCanvas<W, H> &staticCanvas,
+      IS3741_order order = IS3741_BGR)
+      : Adafruit_IS31FL3741_Matrix_buffered<IS3741_QT_layout>(order),
+        Adafruit_IS31FL3741_Canvas_Base<IS3741_QT_layout>(staticCanvas) {}
+  /*!
+    @brief  Scale own canvas; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(void) { scaleCanvas(canvas, ledMap(*this), tracked); }
+  /*!
+    @brief  Scale GFXcanvas8; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas8 *src, const uint16_t *palette) {
+    scaleCanvas(src, palette, ledMap(*this));
+  }
+  /*!
+    @brief  Scale GFXcanvas1; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas1 *src, uint16_t fg, uint16_t bg = 0) {
+    scaleCanvas(src, fg, bg, ledMap(*this));
+  }
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class for IS31FL3741 Adafruit STEMMA QT board, 16-bit buffered
+            with temporal dithering.
+*/
+/**************************************************************************/
+class Adafruit_IS31FL3741_QT_dithered
+    : public Adafruit_IS31FL3741_Matrix_dithered<IS3741_QT_layout> {
+public:
+  /*!
+    @brief  Constructor for STEMMA QT version (13 x 9 LEDs), 16-bit
+            buffered.
+    @param  order  One of the IS3741_order enumeration types for RGB
+                   sequence. Default is IS3741_BGR.
+  */
+  Adafruit_IS31FL3741_QT_dithered(IS3741_order order = IS3741_BGR)
+      : Adafruit_IS31FL3741_Matrix_dithered<IS3741_QT_layout>(order) {}
+};
+
+/* =======================================================================
+   This is the newer and simpler way (to the user) of using Adafruit
+   EyeLights LED glasses. Declaring an EyeLights object (direct or
+   buffered) gets you the matrix and rings automatically; no need to
+   instantiate as separate objects, nor does one need to explicitly
+   declare a base Adafruit_IS31FL3741 object and pass it in. Internally
+   the code has a few more layers but the user doesn't need to see that.
+   =======================================================================*/
+
+class Adafruit_EyeLights;          // Forward declarations for typed parent
+class Adafruit_EyeLights_buffered; // pointers in ring classes below
+
+/**************************************************************************/
+/*!
+    @brief  Base class for EyeLights LED ring. Holds a few items that are
+            common to direct or buffered instances, left or right ring.
+*/
+/**************************************************************************/
+class Adafruit_EyeLights_Ring_Base {
+public:
+  Adafruit_EyeLights_Ring_Base(const Adafruit_IS31FL3741_ColorOrder *order,
+                               bool isRight);
+  /*!
+    @brief    Return number of LEDs in ring (a la NeoPixel)
+    @returns  int  Always 24.
+  */
+  uint8_t numPixels(void) const { return 24; }
+  /*!
+    @brief  Set brightness of LED ring. This is a mathematical brightness
+            scale applied to setPixel() colors when setting ring pixels,
+            distinct from any value passed to setLEDscaling() functions,
+            because matrix and rings share pixels.
+    @param  b  Brightness from 0 (off) to 255 (max).
+  */
+  void setBrightness(uint8_t b) { _brightness = b + 1; }
+
+protected:
+  /*!
+    @brief  Look up the R,G,B LED indices of one ring pixel.
+    @param  n      Pixel index (0-23), not range checked.
+    @param  order  Color order of parent EyeLights object (if
+                   IS3741_RING_RAM is defined, the table is pre-resolved
+                   and only rebuilt if this has changed since).
+    @param  idx    Pointer to 3 LED indices for result.
+  */
+  void ringLEDs(uint8_t n, const Adafruit_IS31FL3741_ColorOrder &order,
+                uint16_t *idx) {
+#if defined(IS3741_RING_RAM)
+    if (((order.rOffset << 4) | (order.gOffset << 2) | order.bOffset) !=
+        ring_order)
+      resolveOrder(order);
+    memcpy(idx, &ring_map[n * 3], 3 * sizeof(uint16_t));
+#else
+    n *= 3;
+    idx[0] = pgm_read_word(&ring_map[n + order.rOffset]);
+    idx[1] = pgm_read_word(&ring_map[n + order.gOffset]);
+    idx[2] = pgm_read_word(&ring_map[n + order.bOffset]);
+#endif
+  }
+  uint16_t _brightness = 256; ///< Internally 1-256 for math
+#if defined(IS3741_RING_RAM)
+  void resolveOrder(const Adafruit_IS31FL3741_ColorOrder &order);
+  uint16_t ring_map[24 * 3]; ///< R,G,B LED indices per pixel, in RAM
+  uint8_t ring_order;        ///< Color order ring_map was resolved for
+  bool right;                ///< true if right ring, false if left
+#else
+  const uint16_t *ring_map; ///< Pointer to LED index lookup table
+#endif
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class for direct (unbuffered) EyeLights LED ring, left or right.
+*/
+/**************************************************************************/
+class Adafruit_EyeLights_Ring : public Adafruit_EyeLights_Ring_Base {
+public:
+  Adafruit_EyeLights_Ring(Adafruit_EyeLights *parent, bool isRight);
+  void setPixelColor(int16_t n, uint32_t color);
+  void setPixelColor(int16_t n, uint8_t t, uint8_t g, uint8_t b);
+  void fill(uint32_t color);
+  void fill(uint8_t r, uint8_t g, uint8_t b);
+  void setPixels(const uint32_t *colors, uint8_t count = 24,
+                 uint8_t rotate = 0);
+  void setPixels(const uint8_t *rgb, uint8_t count = 24, uint8_t rotate = 0);
+
+protected:
+  Adafruit_EyeLights *parent; ///< Pointer back to EyeLights object
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class for buffered EyeLights LED ring, left or right.
+*/
+/**************************************************************************/
+class Adafruit_EyeLights_Ring_buffered : public Adafruit_EyeLights_Ring_Base {
+public:
+  Adafruit_EyeLights_Ring_buffered(Adafruit_EyeLights_buffered *parent,
+                                   bool isRight);
+  void setPixelColor(int16_t n, uint32_t color);
+  void setPixelColor(int16_t n, uint8_t r, uint8_t g, uint8_t b);
+  void fill(uint32_t color);
+  void fill(uint8_t r, uint8_t g, uint8_t b);
+  void setPixels(const uint32_t *colors, uint8_t count = 24,
+                 uint8_t rotate = 0);
+  void setPixels(const uint8_t *rgb, uint8_t count = 24, uint8_t rotate = 0);
+
+protected:
+  Adafruit_EyeLights_buffered *parent; ///< Pointer back to EyeLights object
+};
+
+/**************************************************************************/
+/*!
+    @brief  Base class for EyeLights LED glasses. Holds a few items that
+            are common to direct or buffered instances.
+*/
+/**************************************************************************/
+class Adafruit_EyeLights_Base
+    : public Adafruit_IS31FL3741_Canvas_Base<IS3741_EyeLights_layout> {
+public:
+  /*!
+    @brief  Constructor for Adafruit_EyeLights_Base object. This is used
+            internally by the library, not user code.
+    @param  withCanvas    true to also allocate a 3X size GFXcanvas16
+                          object (can be used for antialiasing via the
+                          smooth() function), false for normal
+                          direct-to-matrix drawing.
+    @param  trackChanges  true to make the canvas track which areas are
+                          drawn to, so scale() only processes those.
+  */
+  Adafruit_EyeLights_Base(bool withCanvas, bool trackChanges)
+      : Adafruit_IS31FL3741_Canvas_Base<IS3741_EyeLights_layout>(
+            withCanvas, trackChanges) {}
+  /*!
+    @brief  Constructor for Adafruit_EyeLights_Base object with a
+            caller-provided canvas. This is used internally by the
+            library, not user code.
+    @param  staticCanvas  54x15 Adafruit_IS31FL3741_StaticCanvas object.
+  */
+  template <uint16_t W, uint16_t H>
+  Adafruit_EyeLights_Base(Adafruit_IS31FL3741_StaticCanvas<W, H> &staticCanvas)
+      : Adafruit_IS31FL3741_Canvas_Base<IS3741_EyeLights_layout>(
+            staticCanvas) {}
 };
 
 /**************************************************************************/
@@ -478,24 +2411,56 @@ protected:
     @brief  Class for Adafruit EyeLights, direct (unbuffered).
 */
 /**************************************************************************/
-class Adafruit_EyeLights : public Adafruit_EyeLights_Base,
-                           public Adafruit_IS31FL3741_colorGFX {
+class Adafruit_EyeLights
+    : public Adafruit_EyeLights_Base,
+      public Adafruit_IS31FL3741_Matrix<IS3741_EyeLights_layout> {
 public:
   /*!
     @brief  Constructor for Adafruit_EyeLights object.
-    @param  withCanvas  true to also allocate a 3X size GFXcanvas16 object
-                        (can be used for antialiasing via the smooth()
-                        function), false for normal direct-to-matrix
-                        drawing. Default is false.
-    @param  order       One of the IS3741_order enumeration types for RGB
-                        sequence. Default is IS3741_BGR.
-  */
-  Adafruit_EyeLights(bool withCanvas = false, IS3741_order order = IS3741_BGR)
-      : Adafruit_EyeLights_Base(withCanvas),
-        Adafruit_IS31FL3741_colorGFX(18, 5, order), left_ring(this, false),
-        right_ring(this, true) {}
-  void drawPixel(int16_t x, int16_t y, uint16_t color);
+    @param  withCanvas    true to also allocate a 3X size GFXcanvas16
+                          object (can be used for antialiasing via the
+                          smooth() function), false for normal
+                          direct-to-matrix drawing. Default is false.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+    @param  trackChanges  true to make the canvas track which areas are
+                          drawn to, so scale() only processes those (see
+                          Adafruit_IS31FL3741_TrackedCanvas). Implies
+                          withCanvas. Default is false.
+  */
+  Adafruit_EyeLights(bool withCanvas = false, IS3741_order order = IS3741_BGR,
+                     bool trackChanges = false)
+      : Adafruit_EyeLights_Base(withCanvas, trackChanges),
+        Adafruit_IS31FL3741_Matrix<IS3741_EyeLights_layout>(order),
+        left_ring(this, false), right_ring(this, true) {}
+  /*!
+    @brief  Constructor for Adafruit_EyeLights object with a
+            caller-provided canvas, so nothing is heap-allocated.
+    @param  staticCanvas  Adafruit_IS31FL3741_StaticCanvas object, which
+                          must be 54x15 (checked at compile time) and
+                          outlive this one.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+  */
+  template <uint16_t W, uint16_t H>
+  Adafruit_EyeLights(Adafruit_IS31FL3741_StaticCanvas<W, H> &staticCanvas,
+                     IS3741_order order = IS3741_BGR)
+      : Adafruit_EyeLights_Base(staticCanvas),
+        Adafruit_IS31FL3741_Matrix<IS3741_EyeLights_layout>(order),
+        left_ring(this, false), right_ring(this, true) {}
   void scale();
+  /*!
+    @brief  Scale GFXcanvas8; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas8 *src, const uint16_t *palette) {
+    scaleCanvas(src, palette, ledMap(*this));
+  }
+  /*!
+    @brief  Scale GFXcanvas1; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas1 *src, uint16_t fg, uint16_t bg = 0) {
+    scaleCanvas(src, fg, bg, ledMap(*this));
+  }
   Adafruit_EyeLights_Ring left_ring;  ///< Left LED ring object
   Adafruit_EyeLights_Ring right_ring; ///< Right LED ring object
 };
@@ -507,26 +2472,290 @@ public:
 /**************************************************************************/
 class Adafruit_EyeLights_buffered
     : public Adafruit_EyeLights_Base,
-      public Adafruit_IS31FL3741_colorGFX_buffered {
+      public Adafruit_IS31FL3741_Matrix_buffered<IS3741_EyeLights_layout> {
 public:
   /*!
     @brief  Constructor for Adafruit_EyeLights_buffered object.
-    @param  withCanvas  true to also allocate a 3X size GFXcanvas16 object
-                        (can be used for antialiasing via the smooth()
-                        function), false for normal direct-to-matrix
-                        drawing. Default is false.
-    @param  order       One of the IS3741_order enumeration types for RGB
-                        sequence. Default is IS3741_BGR.
+    @param  withCanvas    true to also allocate a 3X size GFXcanvas16
+                          object (can be used for antialiasing via the
+                          smooth() function), false for normal
+                          direct-to-matrix drawing. Default is false.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+    @param  trackChanges  true to make the canvas track which areas are
+                          drawn to, so scale() only processes those (see
+                          Adafruit_IS31FL3741_TrackedCanvas). Implies
+                          withCanvas. Default is false.
   */
   Adafruit_EyeLights_buffered(bool withCanvas = false,
-                              IS3741_order order = IS3741_BGR)
-      : Adafruit_EyeLights_Base(withCanvas),
-        Adafruit_IS31FL3741_colorGFX_buffered(18, 5, order),
+                              IS3741_order order = IS3741_BGR,
+                              bool trackChanges = false)
+      : Adafruit_EyeLights_Base(withCanvas, trackChanges),
+        Adafruit_IS31FL3741_Matrix_buffered<IS3741_EyeLights_layout>(order),
+        left_ring(this, false), right_ring(this, true) {}
+  /*!
+    @brief  Constructor for Adafruit_EyeLights_buffered object with a
+            caller-provided canvas, so nothing is heap-allocated.
+    @param  staticCanvas  Adafruit_IS31FL3741_StaticCanvas object, which
+                          must be 54x15 (checked at compile time) and
+                          outlive this one.
+    @param  order         One of the IS3741_order enumeration types for
+                          RGB sequence. Default is IS3741_BGR.
+  */
+  template <uint16_t W, uint16_t H>
+  Adafruit_EyeLights_buffered(
+      Adafruit_IS31FL3741_StaticCanvas<W, H> &staticCanvas,
+      IS3741_order order = IS3741_BGR)
+      : Adafruit_EyeLights_Base(staticCanvas),
+        Adafruit_IS31FL3741_Matrix_buffered<IS3741_EyeLights_layout>(order),
         left_ring(this, false), right_ring(this, true) {}
-  void drawPixel(int16_t x, int16_t y, uint16_t color);
   void scale();
+  /*!
+    @brief  Scale GFXcanvas8; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas8 *src, const uint16_t *palette) {
+    scaleCanvas(src, palette, ledMap(*this));
+  }
+  /*!
+    @brief  Scale GFXcanvas1; see Adafruit_IS31FL3741_Canvas_Base.
+  */
+  void scale(const GFXcanvas1 *src, uint16_t fg, uint16_t bg = 0) {
+    scaleCanvas(src, fg, bg, ledMap(*this));
+  }
   Adafruit_EyeLights_Ring_buffered left_ring;  ///< Left LED ring object
   Adafruit_EyeLights_Ring_buffered right_ring; ///< Right LED ring object
+
+protected:
+  uint8_t ledChannel(uint16_t led);
+
+private:
+  friend class Adafruit_EyeLights_Ring_buffered; // Rings poke ledbuf
+};
+
+/**************************************************************************/
+/*!
+    @brief  Class for Adafruit EyeLights, 16-bit buffered with temporal
+            dithering (see Adafruit_IS31FL3741_Matrix_dithered). The
+            matrix works like the other classes; ring pixels are set
+            through setRingPixelColor16() rather than ring objects.
+*/
+/**************************************************************************/
+class Adafruit_EyeLights_dithered
+    : public Adafruit_IS31FL3741_Matrix_dithered<IS3741_EyeLights_layout> {
+public:
+  /*!
+    @brief  Constructor for Adafruit_EyeLights_dithered object.
+    @param  order  One of the IS3741_order enumeration types for RGB
+                   sequence. Default is IS3741_BGR.
+  */
+  Adafruit_EyeLights_dithered(IS3741_order order = IS3741_BGR)
+      : Adafruit_IS31FL3741_Matrix_dithered<IS3741_EyeLights_layout>(order) {
+  }
+  void setRingPixelColor16(bool right, int16_t n, uint16_t r, uint16_t g,
+                           uint16_t b);
+
+protected:
+  uint8_t ledChannel(uint16_t led);
+};
+
+// STREAMED FRAMES ---------------------------------------------------------
+
+#define IS3741_FRAME_SYNC1 0xA5  ///< First byte of frame header
+#define IS3741_FRAME_SYNC2 0x5A  ///< Second byte of frame header
+#define IS3741_FRAME_RAW 0x01    ///< Frame type: 351 LEDs in register order
+#define IS3741_FRAME_PIXELS 0x02 ///< Frame type: R,G,B pixels, row-major
+
+/**************************************************************************/
+/*!
+    @brief  Class template for receiving whole frames from a Stream (e.g.
+            Serial from a host computer) into a buffered board, calling
+            show() as each frame completes. Bytes are decoded as they
+            arrive, straight into the board's LED buffer; there's no
+            second frame buffer. The Board type is any buffered GFX board
+            class, e.g. Adafruit_IS31FL3741_QT_buffered.
+
+            Frame format, multi-byte values little-endian:
+            - 0xA5 0x5A sync bytes.
+            - Type: IS3741_FRAME_RAW (1) or IS3741_FRAME_PIXELS (2).
+            - 16-bit payload length: 351 for RAW, width() * height() * 3
+              for PIXELS.
+            - Payload. RAW is one byte per LED, in chip register order,
+              as in getBuffer(). PIXELS is R,G,B bytes per pixel, rows
+              top to bottom, each left to right, following rotation.
+            - 16-bit CRC-16/CCITT-FALSE (polynomial 0x1021, initial value
+              0xFFFF) of the type, length and payload bytes.
+
+            A frame with an unexpected length or bad CRC, or one that
+            stalls mid-transfer for longer than the timeout, is dropped
+            and show() is not called. Since there's no second buffer, the
+            LED buffer then holds the part of that frame received so far,
+            and those LEDs are still flagged as changed: a show() called
+            elsewhere before the next good frame (which overwrites it all)
+            will display them. Sketches that also draw to the board
+            between frames should check getDropCount().
+*/
+/**************************************************************************/
+template <class Board> class Adafruit_IS31FL3741_FrameReceiver {
+public:
+  /*!
+    @brief  Constructor for frame receiver.
+    @param  board    Buffered board object that frames are decoded into.
+    @param  stream   Stream that frames are read from, e.g. Serial.
+    @param  timeout  Max milliseconds between bytes of a frame before
+                     it's dropped. Default is 100.
+  */
+  Adafruit_IS31FL3741_FrameReceiver(Board &board, Stream &stream,
+                                    uint16_t timeout = 100)
+      : board(&board), stream(&stream), timeout(timeout) {}
+  /*!
+    @brief    Process any bytes available from the stream. Call this
+              frequently, e.g. each pass through loop(). Stops after a
+              completed frame, leaving any further bytes for the next
+              call.
+    @returns  true if a frame was completed and shown, else false.
+  */
+  bool poll(void) {
+    if (stream->available() <= 0) {
+      // Only a stall if nothing's waiting; a late poll() isn't one
+      if (state && ((millis() - lastByteTime) > timeout))
+        drop();
+      return false;
+    }
+    while (stream->available() > 0) {
+      uint8_t c = stream->read();
+      lastByteTime = millis();
+      if ((state >= WAIT_TYPE) && (state <= WAIT_PAYLOAD))
+        crc = crc16(crc, c);
+      switch (state) {
+      case WAIT_SYNC1:
+        if (c == IS3741_FRAME_SYNC1)
+          state = WAIT_SYNC2;
+        break;
+      case WAIT_SYNC2:
+        if (c == IS3741_FRAME_SYNC2) {
+          crc = 0xFFFF;
+          state = WAIT_TYPE;
+        } else if (c != IS3741_FRAME_SYNC1) {
+          state = WAIT_SYNC1;
+        }
+        break;
+      case WAIT_TYPE:
+        type = c;
+        state = WAIT_LEN_LO;
+        break;
+      case WAIT_LEN_LO:
+        len = c;
+        state = WAIT_LEN_HI;
+        break;
+      case WAIT_LEN_HI:
+        len |= (uint16_t)c << 8;
+        pos = 0;
+        if ((type == IS3741_FRAME_RAW) && (len == 351)) {
+          buf = board->getBuffer(); // Flags all LEDs changed
+          state = WAIT_PAYLOAD;
+        } else if ((type == IS3741_FRAME_PIXELS) &&
+                   (len == board->width() * board->height() * 3)) {
+          x = y = 0;
+          rgb = 0;
+          state = WAIT_PAYLOAD;
+        } else {
+          drop(); // Unknown type or wrong size
+        }
+        break;
+      case WAIT_PAYLOAD:
+        if (type == IS3741_FRAME_RAW) {
+          buf[pos] = c;
+        } else {
+          rgb = (rgb << 8) | c;
+          if ((pos % 3) == 2) { // Last byte of pixel
+            board->setPixelColor(x, y, rgb & 0xFFFFFF);
+            if (++x >= board->width()) {
+              x = 0;
+              y++;
+            }
+          }
+        }
+        if (++pos >= len)
+          state = WAIT_CRC_LO;
+        break;
+      case WAIT_CRC_LO:
+        len = c; // Payload's done, reuse len for received CRC
+        state = WAIT_CRC_HI;
+        break;
+      case WAIT_CRC_HI:
+        if ((len | ((uint16_t)c << 8)) == crc) {
+          state = WAIT_SYNC1;
+          frames++;
+          board->show();
+          return true;
+        }
+        drop(); // Bad CRC
+        break;
+      }
+    }
+    return false;
+  }
+  /*!
+    @brief    Get number of frames received and shown.
+    @returns  uint32_t  Frame count.
+  */
+  uint32_t getFrameCount(void) const { return frames; }
+  /*!
+    @brief    Get number of frames dropped due to unexpected length, bad
+              CRC or timeout.
+    @returns  uint32_t  Dropped frame count.
+  */
+  uint32_t getDropCount(void) const { return drops; }
+
+protected:
+  /*!
+    @brief  Receiver states, i.e. what's expected next from the stream.
+  */
+  enum {
+    WAIT_SYNC1 = 0, ///< First sync byte; idle
+    WAIT_SYNC2,     ///< Second sync byte
+    WAIT_TYPE,      ///< Frame type byte
+    WAIT_LEN_LO,    ///< Payload length, low byte
+    WAIT_LEN_HI,    ///< Payload length, high byte
+    WAIT_PAYLOAD,   ///< Payload bytes
+    WAIT_CRC_LO,    ///< CRC, low byte
+    WAIT_CRC_HI,    ///< CRC, high byte
+  };
+  /*!
+    @brief  Abandon current frame and look for the next one.
+  */
+  void drop(void) {
+    state = WAIT_SYNC1;
+    drops++;
+  }
+  /*!
+    @brief    Add one byte to a CRC-16/CCITT-FALSE checksum.
+    @param    crc  CRC so far (0xFFFF initially).
+    @param    c    Byte to add.
+    @returns  Updated CRC.
+  */
+  static uint16_t crc16(uint16_t crc, uint8_t c) {
+    crc ^= (uint16_t)c << 8;
+    for (uint8_t i = 0; i < 8; i++)
+      crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+    return crc;
+  }
+
+  Board *board;              ///< Board receiving frames
+  Stream *stream;            ///< Stream providing frames
+  uint8_t *buf = NULL;       ///< LED buffer, for RAW frames
+  uint32_t lastByteTime = 0; ///< millis() when last byte was received
+  uint32_t rgb = 0;          ///< Pixel being assembled, for PIXELS frames
+  uint32_t frames = 0;       ///< Frames received and shown
+  uint32_t drops = 0;        ///< Frames dropped
+  uint16_t timeout;          ///< Max milliseconds between bytes of a frame
+  uint16_t len = 0;          ///< Payload length (or received CRC)
+  uint16_t pos = 0;          ///< Bytes of payload received so far
+  uint16_t crc = 0;          ///< CRC computed so far
+  int16_t x = 0;             ///< Next pixel column, for PIXELS frames
+  int16_t y = 0;             ///< Next pixel row, for PIXELS frames
+  uint8_t state = WAIT_SYNC1; ///< One of the WAIT_* states
+  uint8_t type = 0;           ///< Frame type, IS3741_FRAME_*
 };
 
 /* =======================================================================
@@ -640,6 +2869,39 @@ class Adafruit_IS31FL3741_GlassesMatrix_buffered : public Adafruit_GFX {
 public:
   Adafruit_IS31FL3741_GlassesMatrix_buffered(
       Adafruit_IS31FL3741_buffered *controller = NULL, bool withCanvas = false);
+  /*!
+    @brief  Constructor for buffered LED glasses (matrix portion, 18x5
+            LEDs) with a caller-provided canvas, so nothing is
+            heap-allocated.
+    @param  controller    Pointer to Adafruit_IS31FL3741_buffered object.
+    @param  staticCanvas  54x15 canvas object (other sizes won't compile),
+                          which must outlive this one.
+  */
+  Adafruit_IS31FL3741_GlassesMatrix_buffered(
+      Adafruit_IS31FL3741_buffered *controller,
+      Adafruit_IS31FL3741_StaticCanvas<54, 15> &staticCanvas)
+      : Adafruit_GFX(18, 5), _is31(controller), canvas(&staticCanvas),
+        ownCanvas(false) {}
+#pragma GCC diagnostic push // As for Canvas_Base's destructor
+#pragma GCC diagnostic ignored "-Wdelete-non-virtual-dtor"
+  /*!
+    @brief  Destructor, frees the canvas if the constructor allocated it.
+  */
+  ~Adafruit_IS31FL3741_GlassesMatrix_buffered(void) {
+    if (ownCanvas)
+      delete canvas;
+  }
+#pragma GCC diagnostic pop
+  /*!
+    @brief  Not copyable; the object may own its canvas.
+  */
+  Adafruit_IS31FL3741_GlassesMatrix_buffered(
+      const Adafruit_IS31FL3741_GlassesMatrix_buffered &) = delete;
+  /*!
+    @brief  Not assignable, for the same reason as the copy constructor.
+  */
+  Adafruit_IS31FL3741_GlassesMatrix_buffered &
+  operator=(const Adafruit_IS31FL3741_GlassesMatrix_buffered &) = delete;
   void drawPixel(int16_t x, int16_t y, uint16_t color);
   void scale();
   /*!
@@ -651,6 +2913,7 @@ public:
 protected:
   Adafruit_IS31FL3741_buffered *_is31; ///< Pointer to core object
   GFXcanvas16 *canvas = NULL;          ///< Pointer to GFX canvas
+  bool ownCanvas = true;               ///< If set, canvas freed on delete
 };
 
 /**************************************************************************/
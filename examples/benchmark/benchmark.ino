@@ -0,0 +1,220 @@
+// Timing benchmark for the IS31FL3741 library. Measures the common drawing
+// and update calls at several I2C clock speeds and prints the time per call
+// and resulting calls (or frames) per second, so changes to the library or
+// to a sketch's drawing strategy can be compared with real numbers rather
+// than guesses. Any IS31FL3741 board will do -- EyeLights glasses, QT
+// matrix or the evaluation board -- since all of the board classes below
+// talk to the same chip; only the LED mapping differs, so the graphics
+// will look scrambled on the "wrong" board but the timing is valid.
+//
+// It also checks the number of LED bytes that buffered show() sends for a
+// few simple cases against known-good values. These are independent of the
+// microcontroller and I2C speed, so a "FAIL" here means something changed
+// in the library's change-tracking, not that the board is slow.
+//
+// If the library is compiled with IS3741_STATS defined (a compiler flag,
+// e.g. build_flags in PlatformIO), I2C transactions, bytes and page
+// switches per call are shown too.
+//
+// Open the Serial Monitor at 115200 baud to see results. The buffered QT
+// and EVB classes, and the 3X canvas used by scale(), need more RAM than
+// the Arduino Uno has, so those tests are skipped on AVR.
+
+#include <Adafruit_IS31FL3741.h>
+
+// Some boards have just one I2C interface, but some have more...
+TwoWire *i2c = &Wire; // e.g. change this to &Wire1 for QT Py RP2040
+
+#if defined(__AVR__)
+#define BIG_RAM false
+#else
+#define BIG_RAM true
+#endif
+
+Adafruit_IS31FL3741_QT qt;
+Adafruit_IS31FL3741_EVB evb;
+Adafruit_EyeLights glasses(BIG_RAM);
+Adafruit_EyeLights_buffered glasses_buf(BIG_RAM);
+#if BIG_RAM
+Adafruit_IS31FL3741_QT_buffered qt_buf(IS3741_BGR, true); // With canvas
+Adafruit_IS31FL3741_EVB_buffered evb_buf;
+// Canvas that tracks changes, so scale() skips undrawn areas
+Adafruit_EyeLights_buffered glasses_trk(true, IS3741_BGR, true);
+#endif
+
+// I2C clock speeds to test. AVR tops out around 800 KHz; it'll try.
+const uint32_t clocks[] = {100000, 400000, 1000000};
+
+Adafruit_IS31FL3741 *dev; // Object being tested, for stats
+uint16_t color = 0; // Changed on each call so nothing is optimized out
+int errors = 0;     // Count of byte checks that didn't match
+uint32_t ring_colors[24]; // For ring setPixels(), filled in setup()
+
+// The chip is shared by all of the objects above, each of which caches
+// the register page it last selected. Re-initializing before each group
+// of tests keeps those caches honest (and clears the LEDs).
+void prep(Adafruit_IS31FL3741 &d, bool ok, uint32_t clock) {
+  if (!ok) {
+    Serial.println("IS41 not found");
+    for (;;);
+  }
+  i2c->setClock(clock); // Must follow begin(), which sets 400 KHz
+  d.setLEDscaling(0xFF);
+  d.setGlobalCurrent(0x20); // Dim, this runs a while
+  d.enable(true);
+  dev = &d;
+}
+
+// Call func() 'reps' times, print average microseconds and calls/sec.
+void bench(const char *name, void (*func)(void), uint16_t reps) {
+#if defined(IS3741_STATS)
+  dev->resetStats();
+#endif
+  unsigned long t = micros();
+  for (uint16_t i = 0; i < reps; i++) {
+    func();
+    color += 0x0841;
+  }
+  float us = (float)(micros() - t) / reps;
+  Serial.print("  ");
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(us);
+  Serial.print(" us, ");
+  Serial.print(us > 0.0 ? 1000000.0 / us : 0.0);
+  Serial.println("/sec");
+#if defined(IS3741_STATS)
+  const IS3741_stats &s = dev->getStats();
+  Serial.print("    per call: ");
+  Serial.print((float)s.transactions / reps);
+  Serial.print(" transactions, ");
+  Serial.print((float)s.bytes / reps);
+  Serial.print(" bytes, ");
+  Serial.print((float)s.pageMisses / reps);
+  Serial.println(" page switches");
+#endif
+}
+
+// Show buffered matrix and compare bytes sent against expected value.
+void check(const char *name, Adafruit_IS31FL3741_buffered &dev,
+           uint32_t expected) {
+  dev.resetByteCounts();
+  dev.show();
+  uint32_t sent = dev.getBytesSent();
+  Serial.print("  ");
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(sent);
+  Serial.print(" bytes ");
+  if (sent == expected) {
+    Serial.println("PASS");
+  } else {
+    Serial.print("FAIL, expected ");
+    Serial.println(expected);
+    errors++;
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("IS31FL3741 benchmark");
+  for (uint8_t i = 0; i < 24; i++) ring_colors[i] = i * 0x0A0B0C;
+
+  for (uint8_t c = 0; c < sizeof clocks / sizeof clocks[0]; c++) {
+    Serial.print("I2C clock ");
+    Serial.print(clocks[c] / 1000);
+    Serial.println(" KHz");
+
+    // Direct (unbuffered) boards. Every call goes straight to the chip.
+    prep(qt, qt.begin(IS3741_ADDR_DEFAULT, i2c), clocks[c]);
+    bench("QT drawPixel", []() { qt.drawPixel(3, 4, color); }, 100);
+    bench("QT fill", []() { qt.fill(color); }, 10);
+    bench("QT drawFastHLine", []() { qt.drawFastHLine(0, 4, 13, color); },
+          10);
+    bench("QT setBrightness", []() { qt.setBrightness(color >> 8); }, 100);
+    prep(evb, evb.begin(IS3741_ADDR_DEFAULT, i2c), clocks[c]);
+    bench("EVB drawPixel", []() { evb.drawPixel(3, 4, color); }, 100);
+    prep(glasses, glasses.begin(IS3741_ADDR_DEFAULT, i2c), clocks[c]);
+    bench("EyeLights drawPixel", []() { glasses.drawPixel(3, 4, color); },
+          100);
+    bench("EyeLights fill", []() { glasses.fill(color); }, 10);
+    bench("Ring setPixelColor",
+          []() { glasses.left_ring.setPixelColor(5, color * 3); }, 100);
+    bench("Ring fill", []() { glasses.left_ring.fill(color * 3); }, 10);
+    bench("Ring setPixels",
+          []() { glasses.left_ring.setPixels(ring_colors, 24, color); }, 10);
+    if (glasses.getCanvas()) {
+      bench("EyeLights scale", []() {
+        glasses.getCanvas()->fillRect(21, 3, 12, 9, color);
+        glasses.scale();
+      }, 5);
+    }
+
+    // Buffered boards. Drawing is RAM-only, show() does the I2C work.
+    prep(glasses_buf, glasses_buf.begin(IS3741_ADDR_DEFAULT, i2c),
+         clocks[c]);
+    bench("EyeLights_buffered drawPixel",
+          []() { glasses_buf.drawPixel(3, 4, color); }, 100);
+    bench("EyeLights_buffered fill", []() { glasses_buf.fill(color); }, 100);
+    bench("Ring_buffered fill",
+          []() { glasses_buf.left_ring.fill(color * 3); }, 100);
+    bench("Ring_buffered setPixels", []() {
+      glasses_buf.left_ring.setPixels(ring_colors, 24, color);
+    }, 100);
+    if (glasses_buf.getCanvas()) {
+      bench("EyeLights_buffered scale", []() {
+        glasses_buf.getCanvas()->fillRect(21, 3, 12, 9, color);
+        glasses_buf.scale();
+      }, 10);
+    }
+    bench("show (full frame)", []() {
+      glasses_buf.fill(color);
+      glasses_buf.show();
+    }, 10);
+    bench("show (one pixel)", []() {
+      glasses_buf.drawPixel(3, 4, color);
+      glasses_buf.show();
+    }, 100);
+#if BIG_RAM
+    prep(qt_buf, qt_buf.begin(IS3741_ADDR_DEFAULT, i2c), clocks[c]);
+    bench("QT_buffered drawPixel", []() { qt_buf.drawPixel(3, 4, color); },
+          100);
+    bench("QT_buffered scale", []() {
+      qt_buf.getCanvas()->fillRect(9, 6, 12, 9, color);
+      qt_buf.scale();
+    }, 10);
+    prep(evb_buf, evb_buf.begin(IS3741_ADDR_DEFAULT, i2c), clocks[c]);
+    bench("EVB_buffered drawPixel",
+          []() { evb_buf.drawPixel(3, 4, color); }, 100);
+    prep(glasses_trk, glasses_trk.begin(IS3741_ADDR_DEFAULT, i2c),
+         clocks[c]);
+    glasses_trk.scale(); // First one processes everything
+    bench("EyeLights_buffered scale, tracked", []() {
+      glasses_trk.getCanvas()->fillRect(21, 3, 3, 3, color);
+      glasses_trk.scale();
+    }, 10);
+#endif
+  }
+
+  // Byte counts from buffered show(). Same on every board and clock.
+  Serial.println("Buffered show() bytes");
+  glasses_buf.begin(IS3741_ADDR_DEFAULT, i2c);
+  check("After begin()", glasses_buf, 351);
+  check("No changes", glasses_buf, 0);
+  glasses_buf.drawPixel(3, 4, 0xFFFF);
+  check("One pixel", glasses_buf, 3);
+  glasses_buf.left_ring.setPixelColor(5, 0xFFFFFF);
+  check("One ring pixel", glasses_buf, 3);
+  glasses_buf.fill(0x1234);
+  check("Fill", glasses_buf, 294);
+#if BIG_RAM
+  qt_buf.begin(IS3741_ADDR_DEFAULT, i2c);
+  check("QT after begin()", qt_buf, 351);
+  qt_buf.drawPixel(12, 8, 0xFFFF);
+  check("QT one pixel", qt_buf, 3);
+#endif
+  Serial.println(errors ? "Some checks FAILED" : "All checks passed");
+}
+
+void loop() {}
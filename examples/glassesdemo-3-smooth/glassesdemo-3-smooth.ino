@@ -2,6 +2,7 @@
 // prior one, but demonstrates extra smooth graphics on the matrix part.
 // This requires an extra 1.5K RAM and probably won't work on small boards
 // like the Arduino Uno, but any 32-bit microcontroller should be fine.
+// The fourth example shows a 1-bit canvas variant that fits the Uno.
 
 #include <Adafruit_IS31FL3741.h>
 #include <EyeLightsCanvasFont.h> // Different font!
@@ -25,6 +26,8 @@ int text_x;                     // Pos is initialized in setup()
 int text_min;                   // Pos. where text resets (calc'd later)
 int text_y = 15;                // Text base line at bottom of canvas
 uint16_t ring_hue = 0;          // For ring animation
+uint32_t wheel[24];             // Ring colors, computed once in setup()
+uint32_t wheel_rev[24];         // Same, in reverse order for right ring
 
 GFXcanvas16 *canvas;            // Pointer to canvas object
 
@@ -72,6 +75,13 @@ void setup() {
   glasses.right_ring.setBrightness(50);  // Turn down the LED rings brightness,
   glasses.left_ring.setBrightness(50);   // 0 = off, 255 = max
 
+  // Rather than recomputing ring colors every frame, make a color wheel
+  // once here. loop() then spins it by changing a starting index.
+  for (int i=0; i < 24; i++) {
+    wheel[i] = glasses.ColorHSV(i * 65536 / 24);
+    wheel_rev[(24 - i) % 24] = wheel[i];
+  }
+
   // Get text dimensions to determine X coord where scrolling resets
   uint16_t w, h;
   int16_t ignore;
@@ -104,15 +114,12 @@ void loop() {
   // on the LED matrix.
   glasses.scale();
 
-  // Animate the LED rings with a color wheel.
-  for (int i=0; i < glasses.left_ring.numPixels(); i++) {
-    glasses.left_ring.setPixelColor(i, glasses.ColorHSV(
-      ring_hue + i * 65536 / glasses.left_ring.numPixels()));
-  }
-  for (int i=0; i < glasses.right_ring.numPixels(); i++) {
-    glasses.right_ring.setPixelColor(i, glasses.ColorHSV(
-      ring_hue - i * 65536 / glasses.right_ring.numPixels()));
-  }
+  // Animate the LED rings with the color wheel. setPixels() sets a whole
+  // ring from an array, starting at a given pixel index and wrapping
+  // around. The rings spin in opposite directions.
+  uint8_t rot = ((uint32_t)ring_hue * 24) >> 16; // 0 to 23
+  glasses.left_ring.setPixels(wheel, 24, 24 - rot);
+  glasses.right_ring.setPixels(wheel_rev, 24, rot);
   ring_hue += 1000; // Shift color a bit on next frame - makes it spin
 
   glasses.show(); // Always show() with a buffered controller!
@@ -0,0 +1,74 @@
+// Fourth example for Adafruit LED glasses. Same smooth scrolling text as
+// the third, but the 3X drawing canvas is only 1 bit per pixel, with the
+// color applied when scaling down. The canvas then needs just 105 bytes
+// instead of 1.6K, so this one fits on small boards like the Arduino Uno.
+// The trade-off is that the whole message is one color (which can still
+// change from frame to frame).
+
+#include <Adafruit_IS31FL3741.h>
+#include <EyeLightsCanvasFont.h>
+
+// Some boards have just one I2C interface, but some have more...
+TwoWire *i2c = &Wire; // e.g. change this to &Wire1 for QT Py RP2040
+
+// No "true" argument this time, the glasses don't allocate a canvas.
+// Direct (unbuffered) to save a little more RAM.
+Adafruit_EyeLights glasses;
+
+// Instead, we declare our own 1-bit canvas, 3X the matrix size (54x15).
+GFXcanvas1 canvas(54, 15);
+
+char text[] = "ADAFRUIT!";      // A message to scroll
+int text_x = 54;                // Initial position = off right edge
+int text_min;                   // Pos. where text resets (calc'd later)
+int text_y = 15;                // Text base line at bottom of canvas
+uint16_t text_hue = 0;          // For text color animation
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("ISSI3741 LED Glasses Adafruit GFX Test");
+
+  if (! glasses.begin(IS3741_ADDR_DEFAULT, i2c)) {
+    Serial.println("IS41 not found");
+    for (;;);
+  }
+
+  Serial.println("IS41 found!");
+
+  // By default the LED controller communicates over I2C at 400 KHz.
+  // Arduino Uno can usually do 800 KHz, and 32-bit microcontrollers 1 MHz.
+  i2c->setClock(800000);
+
+  // Set brightness to max and bring controller out of shutdown state
+  glasses.setLEDscaling(0xFF);
+  glasses.setGlobalCurrent(0xFF);
+  glasses.enable(true);
+
+  canvas.setFont(&EyeLightsCanvasFont);
+  canvas.setTextWrap(false); // Allow text to extend off edges
+  canvas.setTextColor(1);    // 1-bit canvas: color is just on or off
+
+  // Get text dimensions to determine X coord where scrolling resets
+  uint16_t w, h;
+  int16_t ignore;
+  canvas.getTextBounds(text, 0, 0, &ignore, &ignore, &w, &h);
+  text_min = -w; // Off left edge this many pixels
+}
+
+void loop() {
+  canvas.fillScreen(0); // Clear the whole drawing canvas
+
+  if (--text_x < text_min) { // If text scrolls off left edge,
+    text_x = canvas.width(); // reset position off right edge
+  }
+  canvas.setCursor(text_x, text_y);
+  canvas.print(text);
+
+  // Downsample the canvas to the matrix. Each 3x3 block of bits becomes
+  // one of ten brightness levels of the color passed here; an optional
+  // third argument sets the background color (default is black).
+  glasses.scale(&canvas, glasses.color565(glasses.ColorHSV(text_hue)));
+  text_hue += 256; // Shift color a bit on next frame
+
+  delay(20); // Pause briefly to limit scrolling speed.
+}
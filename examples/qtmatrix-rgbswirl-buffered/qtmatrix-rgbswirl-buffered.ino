@@ -44,9 +44,10 @@ void loop() {
   uint32_t i = 0;
   for (int y=0; y<ledmatrix.height(); y++) {
     for (int x=0; x<ledmatrix.width(); x++) {
+      // setPixelColor() takes the 24-bit color directly, no need to
+      // reduce it to GFX's 16-bit RGB565 via color565() and drawPixel().
       uint32_t color888 = ledmatrix.ColorHSV(i * 65536 / 117 + hue_offset);
-      uint16_t color565 = ledmatrix.color565(color888);
-      ledmatrix.drawPixel(x, y, color565);
+      ledmatrix.setPixelColor(x, y, color888);
       i++;
     }
   }
@@ -0,0 +1,32 @@
+// Serial frame receiver example for the Adafruit IS31FL3741 13x9 PWM RGB
+// LED Matrix Driver w/STEMMA QT / Qwiic connector. A program on the host
+// computer streams whole frames over USB serial and they're shown as they
+// arrive, decoded straight into the matrix's LED buffer. See the
+// Adafruit_IS31FL3741_FrameReceiver notes in Adafruit_IS31FL3741.h for the
+// frame format. For PIXELS frames, that's 13 * 9 * 3 = 351 bytes of R,G,B.
+
+#include <Adafruit_IS31FL3741.h>
+
+Adafruit_IS31FL3741_QT_buffered ledmatrix;
+Adafruit_IS31FL3741_FrameReceiver<Adafruit_IS31FL3741_QT_buffered>
+    receiver(ledmatrix, Serial);
+
+// Some boards have just one I2C interface, but some have more...
+TwoWire *i2c = &Wire; // e.g. change this to &Wire1 for QT Py RP2040
+
+void setup() {
+  Serial.begin(115200);
+
+  if (! ledmatrix.begin(IS3741_ADDR_DEFAULT, i2c)) {
+    while (1);
+  }
+
+  i2c->setClock(800000);
+  ledmatrix.setLEDscaling(0xFF);
+  ledmatrix.setGlobalCurrent(0xFF);
+  ledmatrix.enable(true); // bring out of shutdown
+}
+
+void loop() {
+  receiver.poll(); // Shows each complete, valid frame
+}
@@ -0,0 +1,133 @@
+#include "FakeIS31FL3741.h"
+
+static FakeIS31FL3741 *chips = NULL; // All instances, for find()
+
+FakeIS31FL3741::FakeIS31FL3741(uint8_t addr) : addr(addr) {
+  bufferSize = 32; // Same as AVR Wire, the smallest the library sees
+  powerOn();
+  resetCounts();
+  next = chips;
+  chips = this;
+}
+
+FakeIS31FL3741::~FakeIS31FL3741(void) {
+  for (FakeIS31FL3741 **c = &chips; *c; c = &(*c)->next) {
+    if (*c == this) {
+      *c = next;
+      break;
+    }
+  }
+}
+
+FakeIS31FL3741 *FakeIS31FL3741::find(uint8_t addr) {
+  for (FakeIS31FL3741 *c = chips; c; c = c->next) {
+    if (c->addr == addr)
+      return c;
+  }
+  return NULL;
+}
+
+void FakeIS31FL3741::powerOn(void) {
+  memset(regs, 0, sizeof regs);
+  cmd = 0;
+  unlocked = false;
+  pointer = 0;
+}
+
+void FakeIS31FL3741::resetCounts(void) {
+  transactions = bytes = reads = 0;
+  pageSelects = lockedWrites = badWrites = 0;
+}
+
+// Advance the simulated clock by one transfer's time on the wire: start
+// condition, device address, len bytes each with an ACK bit, and stop.
+void FakeIS31FL3741::busTime(size_t len, uint32_t speed) {
+  uint32_t bits = (len + 1) * 9 + 2;
+  shimAdvanceNanos((uint64_t)bits * 1000000000 / speed);
+}
+
+// Last PWM or scaling register on each of pages 0 to 3
+static const uint8_t pageEnd[4] = {0xB3, 0xAA, 0xB3, 0xAA};
+
+static bool writable(uint8_t page, uint8_t reg) {
+  if (page < 4)
+    return reg <= pageEnd[page];
+  return (reg <= 0x02) || (reg == 0x3F); // Function registers
+}
+
+static bool readable(uint8_t page, uint8_t reg) {
+  if (page < 4)
+    return reg <= pageEnd[page];
+  return reg <= 0x2F; // Function registers, including open/short
+}
+
+bool FakeIS31FL3741::write(const uint8_t *data, size_t len, uint32_t speed) {
+  transactions++;
+  bytes += len;
+  busTime(len, speed);
+  if (nak)
+    return false;
+  if (!len)
+    return true; // Address-only probe
+  uint8_t r = data[0];
+  pointer = r;
+  if (len == 1)
+    return true; // Register address for a following read
+
+  if (r == 0xFE) { // Command register write lock
+    unlocked = (data[1] == 0xC5);
+    return true;
+  }
+  if (r == 0xFD) { // Command register, page select
+    if (!unlocked) {
+      lockedWrites++;
+    } else if (data[1] > 4) {
+      badWrites++;
+    } else {
+      cmd = data[1];
+      pageSelects++;
+    }
+    unlocked = false;
+    return true;
+  }
+
+  for (size_t i = 1; i < len; i++, r++) {
+    if ((r < data[0]) || !writable(cmd, r)) { // No wrap past 0xFF either
+      badWrites++;
+    } else if ((cmd == 4) && (r == 0x3F)) {
+      if (data[i] == 0xAE)
+        powerOn(); // Reset register
+    } else {
+      regs[cmd][r] = data[i];
+    }
+  }
+  return true;
+}
+
+bool FakeIS31FL3741::read(uint8_t *data, size_t len, uint32_t speed) {
+  transactions++;
+  reads++;
+  bytes += len;
+  busTime(len, speed);
+  if (nak)
+    return false;
+  for (size_t i = 0; i < len; i++, pointer++) {
+    if (pointer == 0xFC)
+      data[i] = addr * 2; // ID register
+    else if (pointer == 0xFE)
+      data[i] = unlocked ? 0xC5 : 0x00;
+    else if (readable(cmd, pointer))
+      data[i] = regs[cmd][pointer];
+    else
+      data[i] = 0;
+  }
+  return true;
+}
+
+uint8_t FakeIS31FL3741::pwm(uint16_t led) const {
+  return (led < 180) ? regs[0][led] : regs[1][led - 180];
+}
+
+uint8_t FakeIS31FL3741::scaling(uint16_t led) const {
+  return (led < 180) ? regs[2][led] : regs[3][led - 180];
+}
@@ -0,0 +1,66 @@
+// Register-level emulation of an IS31FL3741 for host tests. An instance
+// answers on the I2C address given to its constructor; the library talks
+// to it through the Adafruit_I2CDevice shim exactly as it would a real
+// chip. Modeled after the datasheet:
+//
+// - 0xFD selects one of five register pages, but only when the write
+//   immediately follows unlocking 0xFE with 0xC5. The lock re-engages
+//   after each 0xFD write. A page write while locked is ignored (and
+//   counted in lockedWrites, which a correct driver never causes).
+// - Pages 0 and 1 are PWM (180 + 171 registers), pages 2 and 3 the
+//   matching scaling registers, page 4 the function registers
+//   (configuration 0x00, global current 0x01, pull-up/down 0x02,
+//   open/short status 0x03-0x2F read-only, reset 0x3F). Writing 0xAE to
+//   page 4 register 0x3F returns every register to its power-on value.
+// - Multi-byte writes auto-increment the register address. Writes past
+//   the end of a page, or to read-only or nonexistent registers, are
+//   dropped and counted in badWrites.
+// - 0xFC is the read-only ID register, returning the 8-bit form of the
+//   chip's I2C address.
+//
+// Each transfer also advances the shim's simulated clock by the time it
+// would take on the wire at the device's bus speed.
+
+#ifndef _FAKE_IS31FL3741_H_
+#define _FAKE_IS31FL3741_H_
+
+#include <Arduino.h>
+
+class FakeIS31FL3741 {
+public:
+  FakeIS31FL3741(uint8_t addr = 0x30);
+  ~FakeIS31FL3741(void);
+  static FakeIS31FL3741 *find(uint8_t addr);
+
+  // Bus side, called by the Adafruit_I2CDevice shim
+  bool write(const uint8_t *data, size_t len, uint32_t speed);
+  bool read(uint8_t *data, size_t len, uint32_t speed);
+
+  // Test side, inspect state without bus traffic or counting
+  uint8_t reg(uint8_t page, uint8_t reg) const { return regs[page][reg]; }
+  uint8_t pwm(uint16_t led) const;
+  uint8_t scaling(uint16_t led) const;
+  uint8_t page(void) const { return cmd; }
+  void resetCounts(void);
+
+  uint32_t transactions; ///< I2C transfers, reads and writes
+  uint32_t bytes;        ///< Bytes written and read, excluding device addr
+  uint32_t reads;        ///< Read transfers
+  uint32_t pageSelects;  ///< Accepted writes to the command register 0xFD
+  uint32_t lockedWrites; ///< Command register writes ignored while locked
+  uint32_t badWrites;    ///< Register writes dropped, see above
+  bool nak = false;      ///< If set, all transfers fail and change nothing
+  size_t bufferSize;     ///< Host I2C buffer size, see maxBufferSize()
+
+private:
+  void powerOn(void);
+  void busTime(size_t len, uint32_t speed);
+  uint8_t addr;
+  uint8_t regs[5][256];
+  uint8_t cmd;     // Selected page
+  bool unlocked;   // 0xFE holds 0xC5
+  uint8_t pointer; // Register address for the next read
+  FakeIS31FL3741 *next;
+};
+
+#endif // _FAKE_IS31FL3741_H_
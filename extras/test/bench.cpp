@@ -0,0 +1,198 @@
+// I2C traffic benchmark for the library's hot paths. Each is run once
+// against the emulator with IS3741_STATS counters zeroed. Its transaction,
+// byte and page switch counts are checked against the golden figures
+// below, and against what the emulator actually saw. Any mismatch exits
+// non-zero, so a change that adds bus traffic to a hot path has to update
+// the figures here deliberately. Also prints the frame rate each path's
+// traffic allows at common I2C speeds (bus time only, no CPU time).
+
+#include "test.h"
+
+#if !defined(IS3741_STATS)
+#error "Benchmark needs IS3741_STATS, see Makefile"
+#endif
+
+static FakeIS31FL3741 chip;
+
+struct Traffic {
+  const char *name;
+  uint32_t transactions; // I2C transactions
+  uint32_t bytes;        // Bytes after device address
+  uint32_t pages;        // Page switches (unlock + select)
+};
+
+// Golden figures, in the order main() runs them
+static const Traffic golden[] = {
+    {"QT drawPixel, all", 143, 520, 13},
+    {"EVB drawPixel, all", 159, 552, 21},
+    {"EyeLights drawPixel, all", 156, 476, 31},
+    {"QT fill", 16, 371, 2},
+    {"EVB fill", 16, 371, 2},
+    {"EyeLights fill", 41, 303, 2},
+    {"QT colorGFX::fill", 71, 456, 17},
+    {"EyeLights colorGFX::fill", 139, 433, 18},
+    {"QT_buffered fill+show", 16, 371, 2},
+    {"EVB_buffered fill+show", 16, 371, 2},
+    {"EyeLights_buffered fill+show", 18, 316, 2},
+    {"EyeLights scale", 139, 433, 18},
+    {"EyeLights_buffered scale+show", 18, 316, 2},
+    {"ring setPixelColor x24", 50, 144, 11},
+    {"ring fill", 41, 125, 6},
+    {"ring_buffered fill+show", 22, 101, 2},
+    {"show full", 16, 371, 2},
+    {"show 1 pixel", 3, 8, 1},
+    {"show unchanged", 0, 0, 0},
+};
+static const uint8_t numGolden = sizeof golden / sizeof golden[0];
+static uint8_t run = 0;
+static int mismatches = 0;
+
+// Compare one path's counts against golden and the emulator, and print
+static void report(const char *name, const IS3741_stats &s) {
+  uint32_t pages = chip.pageSelects;
+  bool ok = (run < numGolden) && !strcmp(name, golden[run].name) &&
+            (s.transactions == golden[run].transactions) &&
+            (s.bytes == golden[run].bytes) && (s.pageMisses == pages) &&
+            (pages == golden[run].pages);
+  // Counters must agree with what the emulator saw on the bus
+  ok &= (s.transactions == chip.transactions) && (s.bytes == chip.bytes);
+  // Bits on the wire: start, address, 9 per byte, stop
+  uint32_t bits = (chip.bytes + chip.transactions) * 9 + chip.transactions * 2;
+  printf("%-30s %5u %6u %3u", name, s.transactions, s.bytes, pages);
+  const uint32_t speeds[] = {100000, 400000, 1000000};
+  for (uint8_t i = 0; i < 3; i++) {
+    if (bits)
+      printf(" %8.1f", (float)speeds[i] / bits);
+    else
+      printf(" %8s", "-");
+  }
+  if (!ok) {
+    mismatches++;
+    if (run < numGolden)
+      printf("  MISMATCH, expected %u %u %u", golden[run].transactions,
+             golden[run].bytes, golden[run].pages);
+    else
+      printf("  MISMATCH, no golden figures");
+  }
+  printf("\n");
+  run++;
+}
+
+// Zero both the object's and the emulator's counters before a path
+static void start(Adafruit_IS31FL3741 &m) {
+  m.resetStats();
+  chip.resetCounts();
+}
+
+template <class M> static void drawPixels(const char *name, M &m) {
+  m.begin();
+  start(m);
+  for (int y = 0; y < m.height(); y++) {
+    for (int x = 0; x < m.width(); x++)
+      m.drawPixel(x, y, 0x1234 + x * y);
+  }
+  report(name, m.getStats());
+}
+
+template <class M> static void fill(const char *name, M &m) {
+  m.begin();
+  start(m);
+  m.fill(0x1234);
+  report(name, m.getStats());
+}
+
+template <class M> static void baseFill(const char *name, M &m) {
+  m.begin();
+  start(m);
+  m.Adafruit_IS31FL3741_colorGFX::fill(0x1234);
+  report(name, m.getStats());
+}
+
+template <class M> static void bufferedFill(const char *name, M &m) {
+  m.begin();
+  m.show();
+  start(m);
+  m.fill(0x1234);
+  m.show();
+  report(name, m.getStats());
+}
+
+int main(void) {
+  printf("%-30s %5s %6s %3s %8s %8s %8s\n", "", "xfers", "bytes", "pg",
+         "fps@100k", "fps@400k", "fps@1M");
+  {
+    Adafruit_IS31FL3741_QT qt;
+    Adafruit_IS31FL3741_EVB evb;
+    Adafruit_EyeLights eyes(true);
+    drawPixels("QT drawPixel, all", qt);
+    drawPixels("EVB drawPixel, all", evb);
+    drawPixels("EyeLights drawPixel, all", eyes);
+    fill("QT fill", qt);
+    fill("EVB fill", evb);
+    fill("EyeLights fill", eyes);
+    baseFill("QT colorGFX::fill", qt);
+    baseFill("EyeLights colorGFX::fill", eyes);
+  }
+  {
+    Adafruit_IS31FL3741_QT_buffered qt;
+    Adafruit_IS31FL3741_EVB_buffered evb;
+    Adafruit_EyeLights_buffered eyes;
+    bufferedFill("QT_buffered fill+show", qt);
+    bufferedFill("EVB_buffered fill+show", evb);
+    bufferedFill("EyeLights_buffered fill+show", eyes);
+  }
+  {
+    Adafruit_EyeLights eyes(true);
+    Adafruit_EyeLights_buffered eyesb(true);
+    eyes.begin();
+    eyesb.begin();
+    eyesb.show();
+    eyes.getCanvas()->fillScreen(0x1234);
+    eyesb.getCanvas()->fillScreen(0x1234);
+    start(eyes);
+    eyes.scale();
+    report("EyeLights scale", eyes.getStats());
+    start(eyesb);
+    eyesb.scale();
+    eyesb.show();
+    report("EyeLights_buffered scale+show", eyesb.getStats());
+  }
+  {
+    Adafruit_EyeLights eyes;
+    eyes.begin();
+    start(eyes);
+    for (int i = 0; i < 24; i++)
+      eyes.left_ring.setPixelColor(i, 0x123456);
+    report("ring setPixelColor x24", eyes.getStats());
+    start(eyes);
+    eyes.right_ring.fill(0x654321);
+    report("ring fill", eyes.getStats());
+    Adafruit_EyeLights_buffered eyesb;
+    eyesb.begin();
+    eyesb.show();
+    start(eyesb);
+    eyesb.left_ring.fill(0x123456);
+    eyesb.show();
+    report("ring_buffered fill+show", eyesb.getStats());
+  }
+  {
+    Adafruit_IS31FL3741_QT_buffered qt;
+    qt.begin();
+    qt.show();
+    start(qt);
+    qt.markDirty();
+    qt.show();
+    report("show full", qt.getStats());
+    start(qt);
+    qt.drawPixel(3, 3, 0xFFFF);
+    qt.show();
+    report("show 1 pixel", qt.getStats());
+    start(qt);
+    qt.show();
+    report("show unchanged", qt.getStats());
+  }
+  if (run != numGolden)
+    mismatches++;
+  printf("bench: %d mismatched\n", mismatches);
+  return mismatches ? 1 : 0;
+}
@@ -0,0 +1,100 @@
+// Adafruit_I2CDevice and register shims. Every transfer goes to the
+// FakeIS31FL3741 at the device's address; with none there, the device
+// isn't detected and all transfers fail.
+
+#include "../FakeIS31FL3741.h"
+#include <Adafruit_BusIO_Register.h>
+
+Adafruit_I2CDevice::Adafruit_I2CDevice(uint8_t addr, TwoWire *theWire)
+    : _addr(addr), _wire(theWire) {}
+
+bool Adafruit_I2CDevice::begin(bool addr_detect) {
+  return !addr_detect || detected();
+}
+
+bool Adafruit_I2CDevice::detected(void) {
+  FakeIS31FL3741 *chip = FakeIS31FL3741::find(_addr);
+  return chip && chip->write(NULL, 0, _wire->clock);
+}
+
+bool Adafruit_I2CDevice::read(uint8_t *buffer, size_t len, bool stop) {
+  (void)stop;
+  FakeIS31FL3741 *chip = FakeIS31FL3741::find(_addr);
+  return chip && (len <= maxBufferSize()) &&
+         chip->read(buffer, len, _wire->clock);
+}
+
+bool Adafruit_I2CDevice::write(const uint8_t *buffer, size_t len, bool stop,
+                               const uint8_t *prefix_buffer,
+                               size_t prefix_len) {
+  (void)stop;
+  FakeIS31FL3741 *chip = FakeIS31FL3741::find(_addr);
+  if (!chip || ((prefix_len + len) > maxBufferSize()))
+    return false;
+  uint8_t data[256];
+  if (prefix_len)
+    memcpy(data, prefix_buffer, prefix_len);
+  if (len)
+    memcpy(&data[prefix_len], buffer, len);
+  return chip->write(data, prefix_len + len, _wire->clock);
+}
+
+bool Adafruit_I2CDevice::write_then_read(const uint8_t *write_buffer,
+                                         size_t write_len, uint8_t *read_buffer,
+                                         size_t read_len, bool stop) {
+  return write(write_buffer, write_len, stop) && read(read_buffer, read_len);
+}
+
+bool Adafruit_I2CDevice::setSpeed(uint32_t desiredclk) {
+  _wire->setClock(desiredclk);
+  return true;
+}
+
+size_t Adafruit_I2CDevice::maxBufferSize(void) {
+  FakeIS31FL3741 *chip = FakeIS31FL3741::find(_addr);
+  return chip ? chip->bufferSize : 32;
+}
+
+Adafruit_BusIO_Register::Adafruit_BusIO_Register(Adafruit_I2CDevice *i2cdevice,
+                                                 uint16_t reg_addr,
+                                                 uint8_t width,
+                                                 uint8_t byteorder,
+                                                 uint8_t address_width)
+    : _device(i2cdevice), _address(reg_addr) {
+  (void)width;
+  (void)byteorder;
+  (void)address_width;
+}
+
+bool Adafruit_BusIO_Register::read(uint8_t *value) {
+  return _device->write_then_read(&_address, 1, value, 1);
+}
+
+uint32_t Adafruit_BusIO_Register::read(void) {
+  uint8_t value;
+  if (!read(&value))
+    return -1;
+  return value;
+}
+
+bool Adafruit_BusIO_Register::write(uint32_t value, uint8_t numbytes) {
+  (void)numbytes;
+  uint8_t data[2] = {_address, (uint8_t)value};
+  return _device->write(data, 2);
+}
+
+Adafruit_BusIO_RegisterBits::Adafruit_BusIO_RegisterBits(
+    Adafruit_BusIO_Register *reg, uint8_t bits, uint8_t shift)
+    : _register(reg), _bits(bits), _shift(shift) {}
+
+uint32_t Adafruit_BusIO_RegisterBits::read(void) {
+  return (_register->read() >> _shift) & ((1 << _bits) - 1);
+}
+
+// Read-modify-write, as in BusIO (which also ignores a failed read)
+bool Adafruit_BusIO_RegisterBits::write(uint32_t data) {
+  uint32_t value = _register->read();
+  uint32_t mask = ((1 << _bits) - 1) << _shift;
+  value = (value & ~mask) | ((data << _shift) & mask);
+  return _register->write(value);
+}
@@ -0,0 +1,35 @@
+// Host stand-in for Adafruit BusIO's register classes, I2C only and with
+// the same semantics as the real ones for the 8-bit registers used here.
+
+#ifndef _SHIM_ADAFRUIT_BUSIO_REGISTER_H_
+#define _SHIM_ADAFRUIT_BUSIO_REGISTER_H_
+
+#include <Adafruit_I2CDevice.h>
+
+class Adafruit_BusIO_Register {
+public:
+  Adafruit_BusIO_Register(Adafruit_I2CDevice *i2cdevice, uint16_t reg_addr,
+                          uint8_t width = 1, uint8_t byteorder = LSBFIRST,
+                          uint8_t address_width = 1);
+  bool read(uint8_t *value);
+  uint32_t read(void);
+  bool write(uint32_t value, uint8_t numbytes = 0);
+
+private:
+  Adafruit_I2CDevice *_device;
+  uint8_t _address;
+};
+
+class Adafruit_BusIO_RegisterBits {
+public:
+  Adafruit_BusIO_RegisterBits(Adafruit_BusIO_Register *reg, uint8_t bits,
+                              uint8_t shift);
+  uint32_t read(void);
+  bool write(uint32_t value);
+
+private:
+  Adafruit_BusIO_Register *_register;
+  uint8_t _bits, _shift;
+};
+
+#endif // _SHIM_ADAFRUIT_BUSIO_REGISTER_H_
@@ -0,0 +1,307 @@
+#include <Adafruit_GFX.h>
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
+  _width = WIDTH;
+  _height = HEIGHT;
+  textcolor = textbgcolor = 0xFFFF;
+  textsize_x = textsize_y = 1;
+}
+
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t color) {
+  drawPixel(x, y, color);
+}
+
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color) {
+  fillRect(x, y, w, h, color);
+}
+
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h,
+                                  uint16_t color) {
+  drawFastVLine(x, y, h, color);
+}
+
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w,
+                                  uint16_t color) {
+  drawFastHLine(x, y, w, color);
+}
+
+// Bresenham's algorithm, as in Adafruit_GFX
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                             uint16_t color) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    std::swap(x0, y0);
+    std::swap(x1, y1);
+  }
+  if (x0 > x1) {
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+  }
+  int16_t dx = x1 - x0, dy = abs(y1 - y0);
+  int16_t err = dx / 2, ystep = (y0 < y1) ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep)
+      writePixel(y0, x0, color);
+    else
+      writePixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation = r & 3;
+  _width = (rotation & 1) ? HEIGHT : WIDTH;
+  _height = (rotation & 1) ? WIDTH : HEIGHT;
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                 uint16_t color) {
+  startWrite();
+  writeLine(x, y, x, y + h - 1, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                 uint16_t color) {
+  startWrite();
+  writeLine(x, y, x + w - 1, y, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  startWrite();
+  for (int16_t i = x; i < x + w; i++)
+    writeFastVLine(i, y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color) {
+  if (x0 == x1) {
+    if (y0 > y1)
+      std::swap(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+  } else if (y0 == y1) {
+    if (x0 > x1)
+      std::swap(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+  } else {
+    startWrite();
+    writeLine(x0, y0, x1, y1, color);
+    endWrite();
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  startWrite();
+  writeFastHLine(x, y, w, color);
+  writeFastHLine(x, y + h - 1, w, color);
+  writeFastVLine(x, y, h, color);
+  writeFastVLine(x + w - 1, y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                                 int16_t w, int16_t h) {
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w; i++)
+      writePixel(x + i, y, pgm_read_word(&bitmap[j * w + i]));
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
+                                 int16_t w, int16_t h) {
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w; i++)
+      writePixel(x + i, y, bitmap[j * w + i]);
+  }
+  endWrite();
+}
+
+// Same structure as the classic-font path of Adafruit_GFX::drawChar(),
+// with an arbitrary but repeatable bit pattern standing in for the font.
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+                            uint16_t color, uint16_t bg, uint8_t size_x,
+                            uint8_t size_y) {
+  startWrite();
+  for (int8_t i = 0; i < 5; i++) {
+    uint8_t line = c * 37 + i * 91;
+    for (int8_t j = 0; j < 8; j++, line >>= 1) {
+      if ((line & 1) || (bg != color)) {
+        uint16_t pen = (line & 1) ? color : bg;
+        if ((size_x == 1) && (size_y == 1))
+          writePixel(x + i, y + j, pen);
+        else
+          writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, pen);
+      }
+    }
+  }
+  if (bg != color) { // If opaque, draw vertical line for last column
+    if ((size_x == 1) && (size_y == 1))
+      writeFastVLine(x + 5, y, 8, bg);
+    else
+      writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+  }
+  endWrite();
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += textsize_y * 8;
+  } else if (c != '\r') {
+    if (wrap && ((cursor_x + textsize_x * 6) > _width)) {
+      cursor_x = 0;
+      cursor_y += textsize_y * 8;
+    }
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x,
+             textsize_y);
+    cursor_x += textsize_x * 6;
+  }
+  return 1;
+}
+
+// Canvas drawPixel() functions map rotated coordinates to the buffer
+static bool canvasXY(int16_t &x, int16_t &y, uint8_t rotation, int16_t w,
+                     int16_t h) {
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = w - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = w - 1 - x;
+    y = h - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = h - 1 - t;
+    break;
+  }
+  return (x >= 0) && (y >= 0) && (x < w) && (y < h);
+}
+
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h, bool allocate_buffer)
+    : Adafruit_GFX(w, h), buffer(NULL), buffer_owned(allocate_buffer) {
+  if (allocate_buffer)
+    buffer = (uint8_t *)calloc(((w + 7) / 8) * h, 1);
+}
+
+GFXcanvas1::~GFXcanvas1(void) {
+  if (buffer_owned)
+    free(buffer);
+}
+
+void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (buffer && canvasXY(x, y, rotation, WIDTH, HEIGHT)) {
+    uint8_t *ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+    if (color)
+      *ptr |= 0x80 >> (x & 7);
+    else
+      *ptr &= ~(0x80 >> (x & 7));
+  }
+}
+
+void GFXcanvas1::fillScreen(uint16_t color) {
+  if (buffer)
+    memset(buffer, color ? 0xFF : 0x00, ((WIDTH + 7) / 8) * HEIGHT);
+}
+
+bool GFXcanvas1::getPixel(int16_t x, int16_t y) const {
+  if (!buffer || !canvasXY(x, y, rotation, WIDTH, HEIGHT))
+    return 0;
+  return buffer[(x / 8) + y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7));
+}
+
+GFXcanvas8::GFXcanvas8(uint16_t w, uint16_t h, bool allocate_buffer)
+    : Adafruit_GFX(w, h), buffer(NULL), buffer_owned(allocate_buffer) {
+  if (allocate_buffer)
+    buffer = (uint8_t *)calloc(w * h, 1);
+}
+
+GFXcanvas8::~GFXcanvas8(void) {
+  if (buffer_owned)
+    free(buffer);
+}
+
+void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (buffer && canvasXY(x, y, rotation, WIDTH, HEIGHT))
+    buffer[x + y * WIDTH] = color;
+}
+
+void GFXcanvas8::fillScreen(uint16_t color) {
+  if (buffer)
+    memset(buffer, color, WIDTH * HEIGHT);
+}
+
+uint8_t GFXcanvas8::getPixel(int16_t x, int16_t y) const {
+  if (!buffer || !canvasXY(x, y, rotation, WIDTH, HEIGHT))
+    return 0;
+  return buffer[x + y * WIDTH];
+}
+
+GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h, bool allocate_buffer)
+    : Adafruit_GFX(w, h), buffer(NULL), buffer_owned(allocate_buffer) {
+  if (allocate_buffer)
+    buffer = (uint16_t *)calloc(w * h, 2);
+}
+
+GFXcanvas16::~GFXcanvas16(void) {
+  if (buffer_owned)
+    free(buffer);
+}
+
+void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (buffer && canvasXY(x, y, rotation, WIDTH, HEIGHT))
+    buffer[x + y * WIDTH] = color;
+}
+
+void GFXcanvas16::fillScreen(uint16_t color) {
+  if (buffer) {
+    for (int32_t i = 0; i < (int32_t)WIDTH * HEIGHT; i++)
+      buffer[i] = color;
+  }
+}
+
+void GFXcanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                uint16_t color) {
+  if (h < 0) { // Negative length extends up, as in Adafruit_GFX
+    y += h + 1;
+    h = -h;
+  }
+  for (int16_t i = 0; i < h; i++)
+    drawPixel(x, y + i, color);
+}
+
+void GFXcanvas16::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                uint16_t color) {
+  if (w < 0) { // Negative length extends left
+    x += w + 1;
+    w = -w;
+  }
+  for (int16_t i = 0; i < w; i++)
+    drawPixel(x + i, y, color);
+}
+
+uint16_t GFXcanvas16::getPixel(int16_t x, int16_t y) const {
+  if (!buffer || !canvasXY(x, y, rotation, WIDTH, HEIGHT))
+    return 0;
+  return buffer[x + y * WIDTH];
+}
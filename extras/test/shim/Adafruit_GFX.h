@@ -0,0 +1,128 @@
+// Host stand-in for the parts of Adafruit_GFX used by Adafruit_IS31FL3741.
+// Virtual functions, their defaults and the order in which they call one
+// another follow the real library, so the board classes' overrides are
+// exercised the same way. Text uses a made-up 5x8 glyph pattern in place
+// of the real font, but goes through drawChar() and writePixel() (or
+// writeFillRect() for scaled text) just as the real library does.
+
+#ifndef _SHIM_ADAFRUIT_GFX_H_
+#define _SHIM_ADAFRUIT_GFX_H_
+
+#include <Arduino.h>
+
+struct GFXfont; // Custom fonts aren't drawn, setFont() is accepted
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+  virtual void startWrite(void) {}
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color);
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             uint16_t color);
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h,
+                              uint16_t color);
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w,
+                              uint16_t color);
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         uint16_t color);
+  virtual void endWrite(void) {}
+  virtual void setRotation(uint8_t r);
+  virtual void invertDisplay(bool i) { (void)i; }
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+  virtual void fillScreen(uint16_t color);
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                        uint16_t color);
+  virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w,
+                     int16_t h);
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w,
+                     int16_t h);
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size_x, uint8_t size_y);
+
+  void setCursor(int16_t x, int16_t y) {
+    cursor_x = x;
+    cursor_y = y;
+  }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) {
+    textcolor = c;
+    textbgcolor = bg;
+  }
+  void setTextSize(uint8_t s) { textsize_x = textsize_y = s ? s : 1; }
+  void setTextWrap(bool w) { wrap = w; }
+  void setFont(const GFXfont *f = NULL) { (void)f; }
+  using Print::write;
+  virtual size_t write(uint8_t c);
+
+  int16_t width(void) const { return _width; }
+  int16_t height(void) const { return _height; }
+  uint8_t getRotation(void) const { return rotation; }
+
+protected:
+  int16_t WIDTH;        ///< Display width, unrotated
+  int16_t HEIGHT;       ///< Display height, unrotated
+  int16_t _width;       ///< Display width as modified by current rotation
+  int16_t _height;      ///< Display height as modified by current rotation
+  int16_t cursor_x = 0; ///< x location to start print()ing text
+  int16_t cursor_y = 0; ///< y location to start print()ing text
+  uint16_t textcolor;   ///< 16-bit text color for print()
+  uint16_t textbgcolor; ///< 16-bit background color for print()
+  uint8_t textsize_x;   ///< Desired magnification in X-axis of text
+  uint8_t textsize_y;   ///< Desired magnification in Y-axis of text
+  uint8_t rotation = 0; ///< Display rotation (0 thru 3)
+  bool wrap = true;     ///< If set, 'wrap' text at right edge of display
+};
+
+class GFXcanvas1 : public Adafruit_GFX {
+public:
+  GFXcanvas1(uint16_t w, uint16_t h, bool allocate_buffer = true);
+  ~GFXcanvas1(void);
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void fillScreen(uint16_t color);
+  bool getPixel(int16_t x, int16_t y) const;
+  uint8_t *getBuffer(void) const { return buffer; }
+
+protected:
+  uint8_t *buffer;
+  bool buffer_owned;
+};
+
+class GFXcanvas8 : public Adafruit_GFX {
+public:
+  GFXcanvas8(uint16_t w, uint16_t h, bool allocate_buffer = true);
+  ~GFXcanvas8(void);
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void fillScreen(uint16_t color);
+  uint8_t getPixel(int16_t x, int16_t y) const;
+  uint8_t *getBuffer(void) const { return buffer; }
+
+protected:
+  uint8_t *buffer;
+  bool buffer_owned;
+};
+
+class GFXcanvas16 : public Adafruit_GFX {
+public:
+  GFXcanvas16(uint16_t w, uint16_t h, bool allocate_buffer = true);
+  ~GFXcanvas16(void);
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void fillScreen(uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  uint16_t getPixel(int16_t x, int16_t y) const;
+  uint16_t *getBuffer(void) const { return buffer; }
+
+protected:
+  uint16_t *buffer;
+  bool buffer_owned;
+};
+
+#endif // _SHIM_ADAFRUIT_GFX_H_
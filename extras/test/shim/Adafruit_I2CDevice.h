@@ -0,0 +1,31 @@
+// Host stand-in for Adafruit BusIO's I2C device class. Same interface as
+// the real thing, but transfers are handed to whichever emulated chip
+// (see FakeIS31FL3741.h) answers at the device's address.
+
+#ifndef _SHIM_ADAFRUIT_I2CDEVICE_H_
+#define _SHIM_ADAFRUIT_I2CDEVICE_H_
+
+#include <Wire.h>
+
+class Adafruit_I2CDevice {
+public:
+  Adafruit_I2CDevice(uint8_t addr, TwoWire *theWire = &Wire);
+  uint8_t address(void) { return _addr; }
+  bool begin(bool addr_detect = true);
+  void end(void) {}
+  bool detected(void);
+  bool read(uint8_t *buffer, size_t len, bool stop = true);
+  bool write(const uint8_t *buffer, size_t len, bool stop = true,
+             const uint8_t *prefix_buffer = nullptr, size_t prefix_len = 0);
+  bool write_then_read(const uint8_t *write_buffer, size_t write_len,
+                       uint8_t *read_buffer, size_t read_len,
+                       bool stop = false);
+  bool setSpeed(uint32_t desiredclk);
+  size_t maxBufferSize(void);
+
+private:
+  uint8_t _addr;
+  TwoWire *_wire;
+};
+
+#endif // _SHIM_ADAFRUIT_I2CDEVICE_H_
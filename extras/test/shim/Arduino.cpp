@@ -0,0 +1,38 @@
+#include <Arduino.h>
+#include <Wire.h>
+
+TwoWire Wire;
+
+static uint64_t nanos = 0; // Simulated time since "power-on"
+
+unsigned long millis(void) { return nanos / 1000000; }
+
+unsigned long micros(void) { return nanos / 1000; }
+
+void delay(unsigned long ms) { nanos += (uint64_t)ms * 1000000; }
+
+void delayMicroseconds(unsigned int us) { nanos += (uint64_t)us * 1000; }
+
+void yield(void) {}
+
+void shimAdvanceNanos(uint64_t ns) { nanos += ns; }
+
+size_t Print::write(const char *str) {
+  size_t n = 0;
+  while (*str)
+    n += write((uint8_t)*str++);
+  return n;
+}
+
+size_t Print::print(long n) {
+  char buf[24];
+  snprintf(buf, sizeof buf, "%ld", n);
+  return write(buf);
+}
+
+size_t Stream::readBytes(uint8_t *buffer, size_t length) {
+  size_t n = 0;
+  while ((n < length) && (available() > 0))
+    buffer[n++] = read();
+  return n;
+}
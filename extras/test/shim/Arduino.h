@@ -0,0 +1,55 @@
+// Minimal Arduino core for building the library and its tests on a Linux
+// host. Only what Adafruit_IS31FL3741 and the tests need is provided.
+// Time is simulated: millis() and micros() advance only through delay(),
+// delayMicroseconds() and the bus time of emulated I2C transfers, so
+// results are identical from run to run.
+
+#ifndef _SHIM_ARDUINO_H_
+#define _SHIM_ARDUINO_H_
+
+#include <algorithm>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+using std::max;
+using std::min;
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield(void);
+void shimAdvanceNanos(uint64_t ns); // Host only, for emulated bus time
+
+class Print {
+public:
+  virtual size_t write(uint8_t c) = 0;
+  size_t write(const char *str);
+  size_t print(const char *str) { return write(str); }
+  size_t print(long n);
+  size_t println(const char *str) { return print(str) + println(); }
+  size_t println(long n) { return print(n) + println(); }
+  size_t println(void) { return write('\n'); }
+};
+
+class Stream : public Print {
+public:
+  virtual int available(void) = 0;
+  virtual int read(void) = 0;
+  virtual int peek(void) = 0;
+  size_t readBytes(uint8_t *buffer, size_t length);
+};
+
+#endif // _SHIM_ARDUINO_H_
@@ -0,0 +1,19 @@
+// Minimal TwoWire for host builds. Transfers go through the
+// Adafruit_I2CDevice shim straight to emulated chips, so this only
+// carries the bus clock, which sets simulated transfer time.
+
+#ifndef _SHIM_WIRE_H_
+#define _SHIM_WIRE_H_
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  void begin(void) {}
+  void setClock(uint32_t freq) { clock = freq; }
+  uint32_t clock = 100000; ///< Bus clock in Hz
+};
+
+extern TwoWire Wire;
+
+#endif // _SHIM_WIRE_H_
@@ -0,0 +1,68 @@
+// Minimal test support shared by the host test programs: CHECK macros
+// that report failures and keep going, and a summary for main() to
+// return as the exit status.
+
+#ifndef _TEST_H_
+#define _TEST_H_
+
+#include "FakeIS31FL3741.h"
+#include <Adafruit_IS31FL3741.h>
+
+static int checks = 0, failures = 0;
+
+static inline bool check(bool ok, const char *what, const char *file,
+                         int line) {
+  checks++;
+  if (!ok) {
+    failures++;
+    fprintf(stderr, "%s:%d: FAILED: %s\n", file, line, what);
+  }
+  return ok;
+}
+
+static inline bool checkEqual(long a, long b, const char *aText,
+                              const char *bText, const char *file, int line) {
+  checks++;
+  if (a != b) {
+    failures++;
+    fprintf(stderr, "%s:%d: FAILED: %s == %s (%ld != %ld)\n", file, line,
+            aText, bText, a, b);
+  }
+  return a == b;
+}
+
+#define CHECK(cond) check((cond), #cond, __FILE__, __LINE__)
+#define CHECK_EQUAL(a, b) checkEqual((a), (b), #a, #b, __FILE__, __LINE__)
+
+// Also confirms that nothing the library sent was rejected by the chip
+static inline int testSummary(const char *name, FakeIS31FL3741 &chip) {
+  CHECK_EQUAL(chip.lockedWrites, 0);
+  CHECK_EQUAL(chip.badWrites, 0);
+  printf("%s: %d checks, %d failed\n", name, checks, failures);
+  return failures ? 1 : 0;
+}
+
+// FNV-1a hash of PWM registers, for comparing whole frames
+static inline uint32_t pwmHash(const FakeIS31FL3741 &chip) {
+  uint32_t h = 2166136261u;
+  for (uint16_t i = 0; i < 351; i++) {
+    h ^= chip.pwm(i);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// Count of PWM registers differing from a 351-byte LED buffer
+static inline int pwmDiff(const FakeIS31FL3741 &chip, const uint8_t *buf) {
+  int n = 0;
+  for (uint16_t i = 0; i < 351; i++)
+    n += (chip.pwm(i) != buf[i]);
+  return n;
+}
+
+// Whether two 351-byte LED buffers match
+static inline bool same(const uint8_t *a, const uint8_t *b) {
+  return !memcmp(a, b, 351);
+}
+
+#endif // _TEST_H_
@@ -0,0 +1,312 @@
+// Antialiased drawing through a 3X canvas: each board's scale(), the
+// general purpose Adafruit_IS31FL3741_Scaler, change-tracking canvases,
+// static canvases and 8-bit palette and 1-bit source canvases.
+
+#include "test.h"
+
+static FakeIS31FL3741 chip;
+
+// Largest difference between two LED buffers
+static int maxDiff(const uint8_t *a, const uint8_t *b) {
+  int most = 0;
+  for (uint16_t i = 0; i < 351; i++)
+    most = max(most, abs(a[i] - b[i]));
+  return most;
+}
+
+static void randomCanvas(GFXcanvas16 *canvas) {
+  uint16_t *buf = canvas->getBuffer();
+  for (int i = canvas->width() * canvas->height(); i--;)
+    buf[i] = rand();
+}
+
+// A board's own scale() and the Scaler at the same settings (3X box
+// filter, gamma 2.6) agree to within rounding
+template <class L, class B> static void testBoardScale(B &m) {
+  m.begin();
+  GFXcanvas16 *canvas = m.getCanvas();
+  CHECK(canvas != NULL);
+  CHECK_EQUAL(canvas->width(), L::width * 3);
+  CHECK_EQUAL(canvas->height(), L::height * 3);
+  randomCanvas(canvas);
+  m.scale();
+  uint8_t a[351];
+  memcpy(a, m.getBuffer(), 351);
+  Adafruit_IS31FL3741_Scaler scaler;
+  CHECK(scaler.begin<L>(m, 3, IS3741_BOX, 2.6));
+  memset(m.getBuffer(), 0, 351);
+  scaler.scale(canvas, m);
+  CHECK(maxDiff(a, m.getBuffer()) <= 1);
+}
+
+// Scaler: direct and buffered matrices get the same values, a uniform
+// canvas gives uniform LEDs at every ratio and kernel, and unsupported
+// ratios are refused
+static void testScaler(void) {
+  Adafruit_EyeLights_buffered eyes(true);
+  eyes.begin();
+  GFXcanvas16 *canvas = eyes.getCanvas();
+  randomCanvas(canvas);
+  Adafruit_IS31FL3741_Scaler scaler;
+  CHECK(scaler.begin<IS3741_EyeLights_layout>(eyes));
+  scaler.scale(canvas, eyes);
+  uint8_t a[351];
+  memcpy(a, eyes.getBuffer(), 351);
+  Adafruit_EyeLights direct;
+  direct.begin();
+  scaler.scale(canvas, direct);
+  int wrong = 0;
+  for (uint16_t i = 0; i < 351; i++) {
+    if (IS3741_EyeLights_layout::slot(i) < 3)
+      wrong += (chip.pwm(i) != a[i]);
+  }
+  CHECK_EQUAL(wrong, 0);
+
+  for (uint8_t ratio = 2; ratio <= 4; ratio++) {
+    for (uint8_t k = 0; k < 2; k++) {
+      GFXcanvas16 big(18 * ratio, 5 * ratio);
+      Adafruit_IS31FL3741_Scaler s;
+      CHECK(s.begin<IS3741_EyeLights_layout>(eyes, ratio, (IS3741_kernel)k,
+                                              1.0));
+      big.fillScreen(0xFFFF);
+      memset(eyes.getBuffer(), 0, 351);
+      s.scale(&big, eyes);
+      const uint8_t *buf = eyes.getBuffer();
+      wrong = 0;
+      for (uint16_t i = 0; i < 351; i++) {
+        if (IS3741_EyeLights_layout::slot(i) < 3)
+          wrong += (buf[i] != 255);
+      }
+      CHECK_EQUAL(wrong, 0);
+    }
+  }
+  CHECK(!scaler.begin<IS3741_QT_layout>(eyes, 5));
+  CHECK(!scaler.begin<IS3741_QT_layout>(eyes, 1));
+}
+
+// scale() on direct boards writes what buffered boards would show
+static void testDirectScale(void) {
+  Adafruit_IS31FL3741_QT_buffered b(IS3741_BGR, true);
+  Adafruit_IS31FL3741_QT d(IS3741_BGR, true);
+  b.begin();
+  d.begin();
+  randomCanvas(b.getCanvas());
+  memcpy(d.getCanvas()->getBuffer(), b.getCanvas()->getBuffer(),
+         39 * 27 * sizeof(uint16_t));
+  b.scale();
+  d.scale();
+  CHECK_EQUAL(pwmDiff(chip, b.getBuffer()), 0);
+  Adafruit_IS31FL3741_QT none;
+  CHECK(none.getCanvas() == NULL);
+  none.begin();
+  none.scale(); // No canvas, does nothing
+}
+
+// Tracked canvases give the same result as untracked ones for every kind
+// of drawing, while sending less for small changes
+static void testTracked(void) {
+  Adafruit_EyeLights_buffered a(true), b(true, IS3741_BGR, true);
+  a.begin();
+  b.begin();
+  CHECK(a.getTrackedCanvas() == NULL);
+  CHECK(b.getTrackedCanvas() != NULL);
+  GFXcanvas16 *ca = a.getCanvas(), *cb = b.getCanvas();
+  int wrong = 0;
+  for (int f = 0; f < 3000; f++) {
+    int rot = rand() % 4, op = rand() % 6, x = rand() % 70 - 8,
+        y = rand() % 70 - 8, w = rand() % 20 - 4, h = rand() % 20 - 4;
+    uint16_t c = rand();
+    for (int i = 0; i < 2; i++) {
+      GFXcanvas16 *canvas = i ? cb : ca;
+      canvas->setRotation(rot);
+      switch (op) {
+      case 0:
+        canvas->drawPixel(x, y, c);
+        break;
+      case 1:
+        canvas->fillRect(x, y, w, h, c);
+        break;
+      case 2:
+        canvas->drawFastHLine(x, y, w, c);
+        break;
+      case 3:
+        canvas->drawFastVLine(x, y, h, c);
+        break;
+      case 4:
+        canvas->drawLine(x, y, x + w, y + h, c);
+        break;
+      case 5:
+        if (!(f % 50))
+          canvas->fillScreen(c);
+        break;
+      }
+    }
+    a.scale();
+    b.scale();
+    if (!same(a.getBuffer(), b.getBuffer())) {
+      wrong++;
+      memcpy(b.getBuffer(), a.getBuffer(), 351);
+    }
+  }
+  CHECK_EQUAL(wrong, 0);
+
+  ca->setRotation(0);
+  cb->setRotation(0);
+  ca->fillScreen(0x1234);
+  cb->fillScreen(0x1234);
+  a.scale();
+  b.scale();
+  a.show();
+  b.show();
+  a.resetByteCounts();
+  b.resetByteCounts();
+  ca->fillRect(10, 3, 6, 6, 0xF800);
+  cb->fillRect(10, 3, 6, 6, 0xF800);
+  a.scale();
+  b.scale();
+  a.show();
+  b.show();
+  CHECK(b.getBytesSent() > 0);
+  CHECK(b.getBytesSent() * 2 < a.getBytesSent());
+
+  // Direct boards write nothing for an unchanged canvas
+  Adafruit_IS31FL3741_QT q(IS3741_BGR, false, true);
+  q.begin();
+  q.getCanvas()->fillScreen(0xFFFF);
+  q.scale();
+  uint32_t t0 = chip.transactions;
+  q.scale();
+  CHECK_EQUAL(chip.transactions, t0);
+  q.getCanvas()->drawPixel(20, 13, 0);
+  q.scale();
+  CHECK(chip.transactions > t0);
+}
+
+static Adafruit_IS31FL3741_StaticCanvas<54, 15> eyesCanvas;
+static Adafruit_IS31FL3741_StaticCanvas<39, 27> qtCanvas;
+static Adafruit_IS31FL3741_StaticCanvas<54, 15> glassesCanvas;
+
+// Static canvases work the same as heap-allocated ones
+static void testStatic(void) {
+  Adafruit_EyeLights_buffered heap(true), fixed(eyesCanvas);
+  heap.begin();
+  fixed.begin();
+  CHECK(fixed.getCanvas() == &eyesCanvas);
+  randomCanvas(heap.getCanvas());
+  memcpy(eyesCanvas.getBuffer(), heap.getCanvas()->getBuffer(),
+         54 * 15 * sizeof(uint16_t));
+  heap.scale();
+  fixed.scale();
+  CHECK(same(heap.getBuffer(), fixed.getBuffer()));
+
+  Adafruit_IS31FL3741_QT q(qtCanvas);
+  q.begin();
+  q.getCanvas()->fillScreen(0xFFFF);
+  q.scale();
+  CHECK(chip.pwm(0) > 0);
+
+  Adafruit_IS31FL3741_buffered controller;
+  Adafruit_IS31FL3741_GlassesMatrix_buffered matrix(&controller,
+                                                    glassesCanvas);
+  CHECK(matrix.getCanvas() == &glassesCanvas);
+}
+
+// 8-bit palette and 1-bit canvases scale the same as the equivalent
+// 16-bit canvas
+static void testLowMem(void) {
+  Adafruit_EyeLights_buffered ref(true), lo(false);
+  ref.begin();
+  lo.begin();
+  GFXcanvas16 *canvas = ref.getCanvas();
+  uint16_t palette[256];
+  for (int i = 0; i < 256; i++)
+    palette[i] = rand();
+  GFXcanvas8 c8(54, 15);
+  for (int i = 0; i < 54 * 15; i++) {
+    uint8_t v = rand();
+    c8.getBuffer()[i] = v;
+    canvas->getBuffer()[i] = palette[v];
+  }
+  ref.scale();
+  lo.scale(&c8, palette);
+  CHECK(same(ref.getBuffer(), lo.getBuffer()));
+
+  GFXcanvas1 c1(54, 15);
+  uint16_t fg = 0xFD20, bg = 0x0811;
+  for (int y = 0; y < 15; y++) {
+    for (int x = 0; x < 54; x++) {
+      bool on = rand() & 1;
+      c1.drawPixel(x, y, on);
+      canvas->drawPixel(x, y, on ? fg : bg);
+    }
+  }
+  ref.scale();
+  lo.scale(&c1, fg, bg);
+  CHECK(same(ref.getBuffer(), lo.getBuffer()));
+
+  GFXcanvas1 wrongSize(50, 15);
+  memset(lo.getBuffer(), 7, 351);
+  lo.scale(&wrongSize, 0xFFFF); // Ignored
+  CHECK_EQUAL(lo.getBuffer()[0], 7);
+
+  Adafruit_IS31FL3741_QT q;
+  Adafruit_IS31FL3741_QT_buffered qb;
+  q.begin();
+  qb.begin();
+  GFXcanvas1 mono(39, 27);
+  for (int i = 0; i < 300; i++)
+    mono.drawPixel(rand() % 39, rand() % 27, 1);
+  q.scale(&mono, 0x07E0);
+  qb.scale(&mono, 0x07E0);
+  CHECK_EQUAL(pwmDiff(chip, qb.getBuffer()), 0);
+}
+
+// Boards free the canvas and LED table they allocated (run the tests
+// under a leak checker to see that), but leave a static canvas alone
+static void testLifetime(void) {
+  for (int i = 0; i < 100; i++) {
+    Adafruit_EyeLights_buffered heap(true), tracked(true, IS3741_RGB, true);
+    Adafruit_IS31FL3741_QT q(IS3741_BGR, true);
+    Adafruit_IS31FL3741_buffered controller;
+    Adafruit_IS31FL3741_GlassesMatrix_buffered matrix(&controller, true);
+    heap.begin();
+    heap.getCanvas()->fillScreen(i);
+    heap.scale();
+  }
+  Adafruit_EyeLights_buffered ref(true);
+  ref.begin();
+  ref.getCanvas()->fillScreen(0x1234);
+  ref.scale();
+  {
+    Adafruit_EyeLights_buffered fixed(eyesCanvas);
+    fixed.getCanvas()->fillScreen(0x1234);
+  }
+  CHECK_EQUAL(eyesCanvas.getPixel(10, 10), 0x1234);
+  Adafruit_EyeLights_buffered again(eyesCanvas);
+  again.begin();
+  again.scale();
+  CHECK(same(ref.getBuffer(), again.getBuffer()));
+}
+
+int main(void) {
+  srand(5);
+  {
+    Adafruit_IS31FL3741_QT_buffered qt(IS3741_BGR, true);
+    testBoardScale<IS3741_QT_layout>(qt);
+  }
+  {
+    Adafruit_IS31FL3741_EVB_buffered evb(IS3741_RGB, true);
+    testBoardScale<IS3741_EVB_layout>(evb);
+  }
+  {
+    Adafruit_EyeLights_buffered eyes(true, IS3741_GRB);
+    testBoardScale<IS3741_EyeLights_layout>(eyes);
+  }
+  testScaler();
+  testDirectScale();
+  testTracked();
+  testStatic();
+  testLowMem();
+  testLifetime();
+  return testSummary("test_canvas", chip);
+}
@@ -0,0 +1,193 @@
+// Core chip access: the emulator itself, begin()/reset(), single LED and
+// function register writes, batching, hardware brightness and (when
+// built with IS3741_STATS) traffic counters.
+
+#include "test.h"
+
+static FakeIS31FL3741 chip;
+
+// The emulator enforces the command register unlock and page ranges
+static void testEmulator(void) {
+  Adafruit_I2CDevice dev(0x30);
+  CHECK(dev.begin());
+  uint8_t select[] = {0xFD, 2}, unlock[] = {0xFE, 0xC5}, data[] = {0xB2, 1, 2};
+  dev.write(select, 2); // Locked, ignored
+  CHECK_EQUAL(chip.lockedWrites, 1);
+  CHECK_EQUAL(chip.page(), 0);
+  dev.write(unlock, 2);
+  dev.write(select, 2);
+  CHECK_EQUAL(chip.page(), 2);
+  dev.write(select, 2); // Lock re-engages after each page select
+  CHECK_EQUAL(chip.lockedWrites, 2);
+  dev.write(data, 3); // 0xB3 is the last scaling register on page 2
+  CHECK_EQUAL(chip.reg(2, 0xB2), 1);
+  CHECK_EQUAL(chip.reg(2, 0xB3), 2);
+  CHECK_EQUAL(chip.badWrites, 0);
+  uint8_t past[] = {0xB4, 3};
+  dev.write(past, 2);
+  CHECK_EQUAL(chip.badWrites, 1);
+  uint8_t id = 0, reg = 0xFC;
+  CHECK(dev.write_then_read(&reg, 1, &id, 1));
+  CHECK_EQUAL(id, 0x60);
+  CHECK(!Adafruit_I2CDevice(0x31).begin()); // Nothing there
+  chip.resetCounts();
+}
+
+static void testBegin(void) {
+  Adafruit_IS31FL3741 is31;
+  CHECK(!is31.begin(0x31)); // No chip at that address
+  FakeIS31FL3741 chip2(0x31);
+  CHECK(is31.begin(0x31));
+  CHECK(is31.setLEDPWM(7, 99));
+  CHECK_EQUAL(chip2.pwm(7), 99);
+  CHECK_EQUAL(chip.pwm(7), 0);
+  CHECK_EQUAL(chip2.lockedWrites + chip2.badWrites, 0);
+
+  // begin() resets the chip to power-on state
+  CHECK(is31.begin());
+  CHECK(is31.setLEDPWM(350, 1));
+  CHECK(is31.setGlobalCurrent(200));
+  CHECK(is31.begin());
+  CHECK_EQUAL(chip.pwm(350), 0);
+  CHECK_EQUAL(chip.reg(4, 1), 0);
+  CHECK_EQUAL(is31.getGlobalCurrent(), 0);
+
+  chip.nak = true; // Chip stops responding
+  CHECK(!is31.setGlobalCurrent(1));
+  CHECK(!is31.begin());
+  chip.nak = false;
+  CHECK(is31.begin());
+}
+
+static void testRegisters(void) {
+  Adafruit_IS31FL3741 is31;
+  is31.begin();
+  CHECK(is31.setLEDPWM(0, 10));
+  CHECK(is31.setLEDPWM(179, 11));
+  CHECK(is31.setLEDPWM(180, 12));
+  CHECK(is31.setLEDPWM(350, 13));
+  CHECK(!is31.setLEDPWM(351, 14)); // Out of range, nothing sent
+  CHECK_EQUAL(chip.pwm(0), 10);
+  CHECK_EQUAL(chip.pwm(179), 11);
+  CHECK_EQUAL(chip.pwm(180), 12);
+  CHECK_EQUAL(chip.pwm(350), 13);
+  CHECK(is31.setLEDscaling(200, 0x42));
+  CHECK_EQUAL(chip.scaling(200), 0x42);
+  CHECK(is31.setLEDscaling(0xFF));
+  int wrong = 0;
+  for (uint16_t i = 0; i < 351; i++)
+    wrong += (chip.scaling(i) != 0xFF);
+  CHECK_EQUAL(wrong, 0);
+  CHECK(is31.fill(0x5A));
+  wrong = 0;
+  for (uint16_t i = 0; i < 351; i++)
+    wrong += (chip.pwm(i) != 0x5A);
+  CHECK_EQUAL(wrong, 0);
+  CHECK(is31.setGlobalCurrent(0x80));
+  CHECK_EQUAL(chip.reg(4, 1), 0x80);
+  CHECK_EQUAL(is31.getGlobalCurrent(), 0x80);
+  CHECK(is31.enable(true));
+  CHECK_EQUAL(chip.reg(4, 0), 0x01);
+  CHECK(is31.enable(false));
+  CHECK_EQUAL(chip.reg(4, 0), 0x00);
+}
+
+// Batched writes land only at endBatch(), in fewer transfers, with the
+// same end result as writing each immediately. A plain object has no
+// queue until given one, and buffered objects have none at all.
+static void testBatch(void) {
+  Adafruit_IS31FL3741 a;
+  a.begin();
+  uint32_t t0 = chip.transactions;
+  for (uint16_t i = 0; i < 351; i++)
+    a.setLEDPWM(350 - i, i);
+  a.setLEDPWM(7, 1); // Repeated LED, last value wins
+  a.setLEDPWM(7, 2);
+  uint32_t direct = chip.transactions - t0;
+  uint32_t hash = pwmHash(chip);
+
+  a.begin();
+  t0 = chip.transactions;
+  a.beginBatch(); // No queue, written as usual
+  a.setLEDPWM(0, 0x55);
+  CHECK_EQUAL(chip.pwm(0), 0x55);
+  CHECK(a.endBatch());
+  CHECK(chip.transactions > t0);
+
+  IS3741_batchEntry queue[40];
+  a.setBatchQueue(queue, 40);
+  a.begin();
+  t0 = chip.transactions;
+  a.beginBatch();
+  a.beginBatch(); // Nesting, only outermost endBatch() sends
+  for (uint16_t i = 0; i < 6; i++)
+    a.setLEDPWM(350 - i, i);
+  CHECK(a.endBatch());
+  CHECK_EQUAL(chip.transactions, t0);
+  for (uint16_t i = 6; i < 351; i++)
+    a.setLEDPWM(350 - i, i);
+  a.setLEDPWM(7, 1);
+  a.setLEDPWM(7, 2);
+  CHECK(a.endBatch());
+  CHECK_EQUAL(pwmHash(chip), hash);
+  CHECK(chip.transactions - t0 < direct / 4);
+}
+
+#if defined(IS3741_STATS)
+// Stats counters agree with the bus, reads included, and count a failed
+// read as a failure
+static void testStats(void) {
+  Adafruit_IS31FL3741 is31;
+  chip.resetCounts();
+  CHECK(is31.begin());
+  CHECK(is31.setLEDPWM(3, 3));
+  CHECK(is31.enable(true));
+  CHECK(is31.setGlobalCurrent(0x40));
+  CHECK_EQUAL(is31.getGlobalCurrent(), 0x40);
+  const IS3741_stats &s = is31.getStats();
+  CHECK_EQUAL(s.transactions, chip.transactions);
+  CHECK_EQUAL(s.bytes, chip.bytes);
+  CHECK_EQUAL(s.reads, chip.reads);
+  CHECK_EQUAL(s.reads, 3); // ID, config, global current
+  CHECK_EQUAL(s.failures, 0);
+  chip.nak = true;
+  CHECK(!is31.enable(false)); // Page 4 already selected, just the read
+  chip.nak = false;
+  CHECK_EQUAL(s.reads, 4);
+  CHECK_EQUAL(s.failures, 1);
+  CHECK_EQUAL(chip.reg(4, 0), 0x01); // Failed read, nothing written
+}
+#endif
+
+// setBrightness() splits a level between global current and scaling,
+// for an overall response that tracks b squared and never steps back
+static void testBrightness(void) {
+  Adafruit_IS31FL3741 is31;
+  is31.begin();
+  uint32_t prev = 0;
+  int reversals = 0;
+  for (int b = 0; b < 256; b++) {
+    CHECK(is31.setBrightness(b));
+    uint32_t out = chip.reg(4, 1) * chip.scaling(0);
+    reversals += (out < prev);
+    prev = out;
+    if (b >= 16)
+      CHECK(fabs((double)out - b * b) <= 0.05 * b * b);
+  }
+  CHECK_EQUAL(reversals, 0);
+  uint32_t t0 = chip.transactions;
+  CHECK(is31.setBrightness(255)); // No change, nothing sent
+  CHECK_EQUAL(chip.transactions, t0);
+}
+
+int main(void) {
+  testEmulator();
+  testBegin();
+  testRegisters();
+  testBatch();
+  testBrightness();
+#if defined(IS3741_STATS)
+  testStats();
+#endif
+  return testSummary("test_chip", chip);
+}
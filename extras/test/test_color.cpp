@@ -0,0 +1,250 @@
+// Show-time color correction (gamma, white balance, LUT brightness), the
+// power model and limit, and 16-bit dithered boards.
+
+#include "test.h"
+
+static FakeIS31FL3741 chip;
+
+static const float gammas[3] = {2.2, 2.6, 1.8};
+static const uint8_t whites[3] = {255, 200, 180};
+
+// Expected corrected value of one channel, as the float formula in the
+// documentation describes it
+static uint8_t corrected(uint8_t c, uint8_t v, uint8_t bright) {
+  return (uint8_t)(pow(v / 255.0, gammas[c]) * whites[c] * bright / 255.0 +
+                   0.5);
+}
+
+// Every matrix pixel set to a random color goes out through the correct
+// channel's table (within 1 step of the formula), while the LED buffer
+// stays linear, also after changing gamma and brightness on existing
+// tables. Then clearing correction sends the buffer as-is.
+template <class L, class M> static void testLUT(M &m, bool async) {
+  m.begin();
+  m.setGamma(gammas[0], gammas[1], gammas[2]);
+  m.setWhiteBalance(whites[0], whites[1], whites[2]);
+  m.setLUTBrightness(128);
+  uint8_t rgb[L::height][L::width][3];
+  for (uint8_t y = 0; y < L::height; y++) {
+    for (uint8_t x = 0; x < L::width; x++) {
+      for (uint8_t c = 0; c < 3; c++)
+        rgb[y][x][c] = rand();
+      m.setPixelColor(x, y, (rgb[y][x][0] << 16) | (rgb[y][x][1] << 8) |
+                                rgb[y][x][2]);
+    }
+  }
+  if (async) {
+    CHECK(m.showAsync());
+    m.waitShow();
+  } else {
+    m.show();
+  }
+  m.setLUTBrightness(128); // No change, nothing to resend
+  m.resetByteCounts();
+  m.show();
+  CHECK_EQUAL(m.getBytesSent(), 0);
+  const uint8_t offset[3] = {m.rOffset, m.gOffset, m.bOffset};
+  const uint8_t bright[2] = {128, 77};
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    if (pass) { // Curves recomputed in place, then rescaled
+      m.setGamma(1.0);
+      m.show();
+      m.setGamma(gammas[0], gammas[1], gammas[2]);
+      m.setLUTBrightness(bright[pass]);
+      m.show();
+    }
+    int wrong = 0, linear = 0;
+    const uint8_t *buf = ((const M &)m).getBuffer(); // Marks nothing
+    for (uint8_t y = 0; y < L::height; y++) {
+      for (uint8_t x = 0; x < L::width; x++) {
+        for (uint8_t c = 0; c < 3; c++) {
+          uint16_t led = L::led(x, y, offset[c]);
+          if (led >= 351)
+            continue;
+          wrong += abs(chip.pwm(led) -
+                       corrected(c, rgb[y][x][c], bright[pass])) > 1;
+          linear += (buf[led] != rgb[y][x][c]);
+        }
+      }
+    }
+    CHECK_EQUAL(wrong, 0);
+    CHECK_EQUAL(linear, 0);
+  }
+
+  m.clearColorCorrection();
+  m.show();
+  CHECK_EQUAL(pwmDiff(chip, m.getBuffer()), 0);
+}
+
+// EyeLights ring LEDs are corrected by channel too
+static void testRingLUT(void) {
+  Adafruit_EyeLights_buffered eyes(false);
+  eyes.begin();
+  eyes.setGamma(gammas[0], gammas[1], gammas[2]);
+  eyes.setWhiteBalance(whites[0], whites[1], whites[2]);
+  eyes.left_ring.setPixelColor(0, 0xC86432);
+  eyes.show();
+  const uint8_t *buf = eyes.getBuffer();
+  const uint8_t want[3] = {200, 100, 50};
+  int found = 0;
+  for (uint16_t led = 0; led < 351; led++) {
+    for (uint8_t c = 0; c < 3; c++) {
+      if (buf[led] == want[c]) {
+        found++;
+        CHECK(abs(chip.pwm(led) - corrected(c, want[c], 255)) <= 1);
+      }
+    }
+  }
+  CHECK_EQUAL(found, 3);
+}
+
+// Sum of PWM registers as the chip has them, for the power model
+static uint32_t pwmSum(void) {
+  uint32_t sum = 0;
+  for (uint16_t i = 0; i < 351; i++)
+    sum += chip.pwm(i);
+  return sum;
+}
+
+// Estimate from what actually reached the chip
+static float chipCurrent(void) {
+  return pwmSum() * chip.scaling(0) * IS3741_LED_MA / (255.0 * 255.0) *
+         chip.reg(4, 1) / 255.0;
+}
+
+// The power model matches the chip's registers, the limit lowers global
+// current only as needed and the requested level returns afterward
+static void testPower(void) {
+  Adafruit_EyeLights_buffered eyes(false);
+  eyes.begin();
+  eyes.setLEDscaling(0xFF);
+  eyes.setGlobalCurrent(0xFF);
+  eyes.setPowerLimit(500);
+  eyes.show();
+  CHECK_EQUAL(eyes.getEstimatedCurrent(), 0);
+  CHECK_EQUAL(chip.reg(4, 1), 0xFF);
+
+  eyes.fill(0xFFFF);
+  eyes.show();
+  CHECK(eyes.getEstimatedCurrent() <= 500);
+  CHECK(eyes.getEstimatedCurrent() > 450);
+  CHECK(chip.reg(4, 1) < 0xFF);
+  CHECK(fabs(chipCurrent() - eyes.getEstimatedCurrent()) < 0.01);
+
+  eyes.fill(0);
+  eyes.drawPixel(3, 2, 0xF800);
+  eyes.show();
+  CHECK_EQUAL(chip.reg(4, 1), 0xFF); // Back to the requested level
+  eyes.setGlobalCurrent(100);
+  eyes.show();
+  CHECK_EQUAL(chip.reg(4, 1), 100);
+
+  // With showAsync(), brighter global current waits for the frame
+  eyes.fill(0xFFFF);
+  eyes.show();
+  uint8_t capped = chip.reg(4, 1);
+  CHECK(capped < 100);
+  eyes.fill(0);
+  CHECK(eyes.showAsync());
+  CHECK_EQUAL(chip.reg(4, 1), capped);
+  eyes.waitShow();
+  CHECK_EQUAL(chip.reg(4, 1), 100);
+
+  // Incremental block sums vs the whole chip, over many small changes
+  int wrong = 0;
+  for (int f = 0; f < 200; f++) {
+    for (int k = 0; k < 5; k++)
+      eyes.drawPixel(rand() % 18, rand() % 5, rand());
+    eyes.show();
+    wrong += fabs(chipCurrent() - eyes.getEstimatedCurrent()) > 0.01;
+  }
+  CHECK_EQUAL(wrong, 0);
+
+  // Estimate follows color correction
+  eyes.setGamma(2.2);
+  eyes.fill(0x8410);
+  eyes.show();
+  CHECK(fabs(chipCurrent() - eyes.getEstimatedCurrent()) < 0.01);
+  eyes.setPowerLimit(0, 0); // Model off
+  CHECK_EQUAL(eyes.getEstimatedCurrent(), 0);
+  CHECK_EQUAL(chip.reg(4, 1), 100);
+}
+
+// Dithered boards average out to the 16-bit level over repeated show()
+// calls, send nothing for steady whole levels, and draw the same as the
+// 8-bit buffered classes
+static void testDithered(void) {
+  Adafruit_IS31FL3741_QT_dithered qt;
+  qt.begin();
+  qt.fill16(0x0140, 0x0140, 0x0140); // 1.25 steps
+  uint32_t sum[351] = {0};
+  for (int f = 0; f < 256; f++) {
+    qt.show();
+    for (uint16_t i = 0; i < 351; i++)
+      sum[i] += chip.pwm(i);
+  }
+  int wrong = 0;
+  for (uint16_t i = 0; i < 351; i++)
+    wrong += (sum[i] != 320);
+  CHECK_EQUAL(wrong, 0);
+
+  qt.fill16(0x0500, 0x0500, 0x0500);
+  qt.show();
+  qt.show();
+  qt.resetByteCounts();
+  for (int f = 0; f < 10; f++)
+    qt.show();
+  CHECK_EQUAL(qt.getBytesSent(), 0);
+  qt.fill16(0xFFFF, 0xFFFF, 0xFFFF);
+  qt.show();
+  qt.show();
+  for (uint16_t i = 0; i < 351; i++)
+    wrong += (chip.pwm(i) != 0xFF);
+  CHECK_EQUAL(wrong, 0);
+
+  qt.begin();
+  qt.setRotation(1);
+  qt.fillRect(1, 2, 5, 7, 0x1234);
+  qt.setPixelColor(3, 3, 0xABCDEF);
+  qt.show();
+  uint32_t hash = pwmHash(chip);
+  Adafruit_IS31FL3741_QT_buffered ref;
+  ref.begin();
+  ref.setRotation(1);
+  ref.fillRect(1, 2, 5, 7, 0x1234);
+  ref.setPixelColor(3, 3, 0xABCDEF);
+  ref.show();
+  CHECK_EQUAL(pwmHash(chip), hash);
+
+  Adafruit_EyeLights_dithered eyes;
+  eyes.begin();
+  eyes.setRingPixelColor16(true, 5, 0xFFFF, 0, 0x8000);
+  eyes.show();
+  hash = pwmHash(chip);
+  Adafruit_EyeLights_buffered eyes8(false);
+  eyes8.begin();
+  eyes8.right_ring.setPixelColor(5, 0xFF0080);
+  eyes8.show();
+  CHECK_EQUAL(pwmHash(chip), hash);
+}
+
+int main(void) {
+  srand(3);
+  {
+    Adafruit_IS31FL3741_QT_buffered qt(IS3741_GRB);
+    testLUT<IS3741_QT_layout>(qt, false);
+    testLUT<IS3741_QT_layout>(qt, true);
+  }
+  {
+    Adafruit_IS31FL3741_EVB_buffered evb;
+    testLUT<IS3741_EVB_layout>(evb, false);
+  }
+  {
+    Adafruit_EyeLights_buffered eyes(false);
+    testLUT<IS3741_EyeLights_layout>(eyes, false);
+  }
+  testRingLUT();
+  testPower();
+  testDithered();
+  return testSummary("test_color", chip);
+}
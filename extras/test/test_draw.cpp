@@ -0,0 +1,369 @@
+// Drawing fast paths against plain per-pixel references: fillRect() and
+// lines, solid fills, bitmaps, 24-bit blits and text, in every rotation
+// and color order, plus show() sending only what changed and showAsync()
+// sending it a span at a time.
+
+#include "test.h"
+
+static FakeIS31FL3741 chip, chip2(0x31);
+
+static const IS3741_order orders[] = {IS3741_RGB, IS3741_RBG, IS3741_GRB,
+                                      IS3741_GBR, IS3741_BRG, IS3741_BGR};
+
+// Compare two LED buffers only at LEDs a layout's pixels map to, so that
+// fills reaching LEDs outside the matrix (e.g. EyeLights rings) compare
+// equal to per-pixel drawing
+template <class L> static bool sameMatrix(const uint8_t *a, const uint8_t *b) {
+  for (uint8_t y = 0; y < L::height; y++) {
+    for (uint8_t x = 0; x < L::width; x++) {
+      for (uint8_t c = 0; c < 3; c++) {
+        uint16_t led = L::led(x, y, c);
+        if ((led < 351) && (a[led] != b[led]))
+          return false;
+      }
+    }
+  }
+  return true;
+}
+
+// fillRect(), drawFastHLine() and drawFastVLine() on buffered boards,
+// including clipping and negative sizes, vs drawPixel()
+template <class M> static void testRect(M &a, M &b) {
+  a.begin();
+  b.begin();
+  int wrong = 0;
+  for (int i = 0; i < 3000; i++) {
+    int rot = rand() % 4, x = rand() % 30 - 8, y = rand() % 30 - 8;
+    int w = rand() % 30 - 12, h = rand() % 30 - 12;
+    uint16_t c = rand();
+    a.setRotation(rot);
+    b.setRotation(rot);
+    switch (rand() % 3) {
+    case 0:
+      a.fillRect(x, y, w, h, c);
+      break;
+    case 1:
+      a.drawFastHLine(x, y, w, c);
+      h = 1;
+      break;
+    case 2:
+      a.drawFastVLine(x, y, h, c);
+      w = 1;
+      break;
+    }
+    if (w < 0) {
+      x += w + 1;
+      w = -w;
+    }
+    if (h < 0) {
+      y += h + 1;
+      h = -h;
+    }
+    for (int j = 0; j < h; j++) {
+      for (int k = 0; k < w; k++)
+        b.drawPixel(x + k, y + j, c);
+    }
+    wrong += !same(a.getBuffer(), b.getBuffer());
+  }
+  CHECK_EQUAL(wrong, 0);
+}
+
+// Solid fill() on buffered boards vs drawPixel() on every pixel
+template <class L, class M> static void testBufferedFill(M &a, M &b) {
+  a.begin();
+  b.begin();
+  int wrong = 0;
+  for (int i = 0; i < 500; i++) {
+    uint16_t c = (i < 2) ? i * 0xFFFF : rand();
+    a.fill(c);
+    for (int y = 0; y < b.height(); y++) {
+      for (int x = 0; x < b.width(); x++)
+        b.drawPixel(x, y, c);
+    }
+    wrong += !sameMatrix<L>(a.getBuffer(), b.getBuffer());
+  }
+  CHECK_EQUAL(wrong, 0);
+}
+
+// fill() on EyeLights_buffered leaves ring-only LEDs alone, including for
+// grays whose R, G and B expand alike; only black and white reach them
+static void testRingFill(void) {
+  Adafruit_EyeLights_buffered eyes;
+  eyes.begin();
+  bool matrix[351] = {false};
+  for (uint8_t y = 0; y < IS3741_EyeLights_layout::height; y++) {
+    for (uint8_t x = 0; x < IS3741_EyeLights_layout::width; x++) {
+      for (uint8_t c = 0; c < 3; c++) {
+        uint16_t led = IS3741_EyeLights_layout::led(x, y, c);
+        if (led < 351)
+          matrix[led] = true;
+      }
+    }
+  }
+  const uint16_t colors[] = {0x0841, 0x0842, 0x1082, 0xE71C, 0xF79E};
+  int wrong = 0;
+  for (uint8_t i = 0; i < 5; i++) {
+    eyes.left_ring.fill(0x123456);
+    eyes.right_ring.fill(0x654321);
+    uint8_t before[351];
+    memcpy(before, eyes.getBuffer(), 351);
+    eyes.fill(colors[i]);
+    for (uint16_t led = 0; led < 351; led++)
+      wrong += !matrix[led] && (eyes.getBuffer()[led] != before[led]);
+  }
+  CHECK_EQUAL(wrong, 0);
+  eyes.fill(0xFFFF);
+  for (uint16_t led = 0; led < 351; led++)
+    wrong += (eyes.getBuffer()[led] != 0xFF);
+  CHECK_EQUAL(wrong, 0);
+}
+
+// Burst fill() on direct boards vs the generic pixel-by-pixel fill
+template <class M> static void testDirectFill(M &m) {
+  m.begin();
+  int wrong = 0;
+  for (int i = 0; i < 20; i++) {
+    uint16_t c = rand();
+    m.Adafruit_IS31FL3741::fill(i); // Same starting point for both
+    m.Adafruit_IS31FL3741_colorGFX::fill(c);
+    uint32_t hash = pwmHash(chip);
+    m.Adafruit_IS31FL3741::fill(i);
+    m.fill(c);
+    wrong += (pwmHash(chip) != hash);
+  }
+  CHECK_EQUAL(wrong, 0);
+}
+
+// drawRGBBitmap() (RAM and PROGMEM versions) vs drawPixel()
+template <class M> static void testBitmap(M &a, M &b) {
+  a.begin();
+  b.begin();
+  uint16_t bitmap[25 * 25];
+  int wrong = 0;
+  for (int i = 0; i < 2000; i++) {
+    int rot = rand() % 4, x = rand() % 30 - 12, y = rand() % 30 - 12;
+    int w = rand() % 25, h = rand() % 25;
+    a.setRotation(rot);
+    b.setRotation(rot);
+    for (int k = 0; k < w * h; k++)
+      bitmap[k] = rand();
+    if (rand() & 1)
+      a.drawRGBBitmap(x, y, bitmap, w, h);
+    else
+      a.drawRGBBitmap(x, y, (const uint16_t *)bitmap, w, h);
+    for (int j = 0; j < h; j++) {
+      for (int k = 0; k < w; k++)
+        b.drawPixel(x + k, y + j, bitmap[j * w + k]);
+    }
+    wrong += !same(a.getBuffer(), b.getBuffer());
+  }
+  CHECK_EQUAL(wrong, 0);
+}
+
+// blitRGB888() on buffered boards vs setPixelColor(), and the result
+// after show() vs setPixelColor() on the matching direct board. That one
+// drives a second chip, as objects sharing a chip each cache its page.
+template <class M, class D> static void testBlit(M &a, M &b, D &d) {
+  a.begin();
+  b.begin();
+  d.begin(0x31);
+  uint8_t frame[20 * 20 * 3];
+  for (int rot = 0; rot < 4; rot++) {
+    a.setRotation(rot);
+    b.setRotation(rot);
+    d.setRotation(rot);
+    for (size_t i = 0; i < sizeof frame; i++)
+      frame[i] = rand();
+    int w = a.width(), h = a.height(), stride = w * 3 + 5;
+    a.blitRGB888(frame, stride);
+    for (int y = 0; y < h; y++) {
+      for (int x = 0; x < w; x++) {
+        const uint8_t *p = &frame[y * stride + x * 3];
+        uint32_t c = ((uint32_t)p[0] << 16) | (p[1] << 8) | p[2];
+        b.setPixelColor(x, y, c);
+        d.setPixelColor(x, y, c);
+      }
+    }
+    CHECK(same(a.getBuffer(), b.getBuffer()));
+    a.show();
+    CHECK_EQUAL(pwmHash(chip), pwmHash(chip2));
+    a.blitRGB888(frame); // Packed rows
+    for (int y = 0; y < h; y++) {
+      for (int x = 0; x < w; x++) {
+        const uint8_t *p = &frame[(y * w + x) * 3];
+        b.setPixelColor(x, y, ((uint32_t)p[0] << 16) | (p[1] << 8) | p[2]);
+      }
+    }
+    CHECK(same(a.getBuffer(), b.getBuffer()));
+  }
+}
+
+// Text (via drawChar() and writePixel()) vs the same text drawn on a
+// canvas and copied over with drawPixel()
+template <class M> static void testText(M &a, M &b) {
+  a.begin();
+  b.begin();
+  GFXcanvas16 canvas(a.width(), a.height());
+  for (uint8_t size = 1; size <= 2; size++) {
+    a.fill(0);
+    canvas.fillScreen(0);
+    a.setTextSize(size);
+    canvas.setTextSize(size);
+    a.setTextColor(0xF81F);
+    canvas.setTextColor(0xF81F);
+    a.setCursor(-1, 1);
+    canvas.setCursor(-1, 1);
+    a.print("Hi!\n2");
+    canvas.print("Hi!\n2");
+    for (int y = 0; y < b.height(); y++) {
+      for (int x = 0; x < b.width(); x++)
+        b.drawPixel(x, y, canvas.getPixel(x, y));
+    }
+    CHECK(same(a.getBuffer(), b.getBuffer()));
+  }
+}
+
+// show() sends only spans of changed LEDs, and nothing after the buffer
+// is only read
+static void testShow(void) {
+  Adafruit_IS31FL3741_buffered b;
+  b.begin();
+  b.show();
+  CHECK_EQUAL(b.getBytesSent(), 351);
+  uint32_t t0 = chip.transactions;
+  b.show();
+  CHECK_EQUAL(chip.transactions, t0); // Nothing changed, nothing sent
+  const Adafruit_IS31FL3741_buffered &readOnly = b;
+  CHECK_EQUAL(readOnly.getBuffer()[0], 0);
+  b.show();
+  CHECK_EQUAL(chip.transactions, t0); // Nor does reading the buffer
+
+  uint8_t *buf = b.getBuffer();
+  b.show();
+  b.resetByteCounts();
+  const uint16_t leds[] = {0, 10, 12, 179, 180, 350};
+  for (uint8_t i = 0; i < sizeof leds / sizeof leds[0]; i++) {
+    buf[leds[i]] = i + 1;
+    b.markDirty(leds[i]);
+  }
+  memset(&buf[200], 0x77, 20);
+  b.markDirty(200, 20);
+  b.show();
+  CHECK_EQUAL(b.getBytesSent(), 1 + 3 + 1 + 1 + 20 + 1); // 10-12 bridged
+  CHECK_EQUAL(b.getBytesSent() + b.getBytesSkipped(), 351);
+  CHECK_EQUAL(pwmDiff(chip, buf), 0);
+
+  b.setFullRefresh(true);
+  b.resetByteCounts();
+  b.show();
+  CHECK_EQUAL(b.getBytesSent(), 351);
+}
+
+// showAsync() returns without touching the bus, and each poll() sends at
+// most one span, so neither blocks for anything like a frame's bus time.
+// Drawing meanwhile doesn't disturb the frame being sent.
+static void testShowAsync(void) {
+  Adafruit_IS31FL3741_QT_buffered b;
+  b.begin();
+  b.show();
+  unsigned long t0 = micros();
+  b.markDirty();
+  b.show();
+  unsigned long full = micros() - t0;
+
+  b.fill(0x1234);
+  uint8_t frame[351];
+  memcpy(frame, b.getBuffer(), 351);
+  uint32_t tx = chip.transactions;
+  t0 = micros();
+  CHECK(b.showAsync());
+  CHECK_EQUAL(micros() - t0, 0);
+  CHECK_EQUAL(chip.transactions, tx);
+  CHECK(!b.isShowComplete());
+  b.fill(0);
+  unsigned long longest = 0;
+  int polls = 0, wide = 0;
+  while (!b.isShowComplete()) {
+    tx = chip.transactions;
+    t0 = micros();
+    b.poll();
+    longest = max(longest, micros() - t0);
+    wide += (chip.transactions - tx > 3); // One span, maybe a page switch
+    polls++;
+  }
+  CHECK(polls > 1);
+  CHECK_EQUAL(wide, 0);
+  CHECK(longest * 4 < full);
+  CHECK_EQUAL(pwmDiff(chip, frame), 0);
+  tx = chip.transactions;
+  b.poll(); // Nothing in progress, nothing sent
+  b.waitShow();
+  CHECK_EQUAL(chip.transactions, tx);
+
+  // show() and a second showAsync() finish one in progress first
+  CHECK(b.showAsync());
+  b.poll();
+  b.show();
+  CHECK(b.isShowComplete());
+  CHECK_EQUAL(pwmDiff(chip, b.getBuffer()), 0);
+  b.fill(0xFFFF);
+  CHECK(b.showAsync());
+  b.fill(0xF800);
+  CHECK(b.showAsync());
+  b.waitShow();
+  CHECK_EQUAL(pwmDiff(chip, b.getBuffer()), 0);
+}
+
+int main(void) {
+  srand(1);
+  for (uint8_t i = 0; i < 6; i++) {
+    IS3741_order o = orders[i];
+    {
+      Adafruit_IS31FL3741_QT_buffered a(o), b(o);
+      testBufferedFill<IS3741_QT_layout>(a, b);
+    }
+    {
+      Adafruit_IS31FL3741_EVB_buffered a(o), b(o);
+      testBufferedFill<IS3741_EVB_layout>(a, b);
+    }
+    {
+      Adafruit_EyeLights_buffered a(false, o), b(false, o);
+      testBufferedFill<IS3741_EyeLights_layout>(a, b);
+    }
+    Adafruit_IS31FL3741_QT qt(o);
+    testDirectFill(qt);
+    Adafruit_IS31FL3741_EVB evb(o);
+    testDirectFill(evb);
+    Adafruit_EyeLights eyes(false, o);
+    testDirectFill(eyes);
+  }
+  testRingFill();
+  {
+    Adafruit_IS31FL3741_QT_buffered a, b;
+    Adafruit_IS31FL3741_QT d;
+    testRect(a, b);
+    testBitmap(a, b);
+    testBlit(a, b, d);
+    testText(a, b);
+  }
+  {
+    Adafruit_IS31FL3741_EVB_buffered a, b;
+    Adafruit_IS31FL3741_EVB d;
+    testRect(a, b);
+    testBitmap(a, b);
+    testBlit(a, b, d);
+    testText(a, b);
+  }
+  {
+    Adafruit_EyeLights_buffered a, b;
+    Adafruit_EyeLights d;
+    testRect(a, b);
+    testBitmap(a, b);
+    testBlit(a, b, d);
+    testText(a, b);
+  }
+  testShow();
+  testShowAsync();
+  CHECK_EQUAL(chip2.lockedWrites + chip2.badWrites, 0);
+  return testSummary("test_draw", chip);
+}
@@ -0,0 +1,140 @@
+// EyeLights rings: direct and buffered rings agree for every color order,
+// ring brightness applies, bulk setPixels() (packed colors and R,G,B
+// bytes, with rotation) matches setPixelColor() one pixel at a time, and
+// rings follow a change of color order.
+
+#include "test.h"
+
+static FakeIS31FL3741 chip;
+
+static const IS3741_order orders[] = {IS3741_RGB, IS3741_RBG, IS3741_GRB,
+                                      IS3741_GBR, IS3741_BRG, IS3741_BGR};
+
+// The same ring drawing on direct and buffered glasses leaves the chip in
+// the same state, and each ring touches only its own 72 LEDs
+static void testRings(void) {
+  for (uint8_t o = 0; o < 6; o++) {
+    Adafruit_EyeLights d(false, orders[o]);
+    d.begin();
+    for (int i = 0; i < 24; i++) {
+      d.left_ring.setPixelColor(i, 0x123456 * i);
+      d.right_ring.setPixelColor(i, i * 9, i * 7, i * 3);
+    }
+    d.left_ring.setBrightness(77);
+    d.left_ring.setPixelColor(3, 0xFFFFFF);
+    d.right_ring.setPixelColor(-1, 0xFFFFFF); // Out of range, ignored
+    d.right_ring.setPixelColor(24, 0xFFFFFF);
+    uint32_t hash = pwmHash(chip);
+    int lit = 0;
+    for (uint16_t i = 0; i < 351; i++)
+      lit += (chip.pwm(i) != 0);
+
+    Adafruit_EyeLights_buffered b(false, orders[o]);
+    b.begin();
+    for (int i = 0; i < 24; i++) {
+      b.left_ring.setPixelColor(i, 0x123456 * i);
+      b.right_ring.setPixelColor(i, i * 9, i * 7, i * 3);
+    }
+    b.left_ring.setBrightness(77);
+    b.left_ring.setPixelColor(3, 0xFFFFFF);
+    b.right_ring.setPixelColor(-1, 0xFFFFFF);
+    b.right_ring.setPixelColor(24, 0xFFFFFF);
+    b.show();
+    CHECK_EQUAL(pwmHash(chip), hash);
+    CHECK(lit <= 2 * 24 * 3);
+    CHECK(lit > 24 * 3);
+
+    d.begin();
+    d.left_ring.fill(0x102030);
+    d.right_ring.fill(4, 5, 6);
+    hash = pwmHash(chip);
+    b.begin();
+    b.left_ring.fill(0x102030);
+    b.right_ring.fill(4, 5, 6);
+    b.show();
+    CHECK_EQUAL(pwmHash(chip), hash);
+  }
+}
+
+// setPixels() in both forms vs setPixelColor() per pixel, over a range
+// of counts (including more than 24) and rotations, direct and buffered
+static void testSetPixels(void) {
+  uint32_t colors[26];
+  uint8_t rgb[26 * 3];
+  for (int i = 0; i < 26; i++) {
+    colors[i] = rand() & 0xFFFFFF;
+    rgb[i * 3] = colors[i] >> 16;
+    rgb[i * 3 + 1] = colors[i] >> 8;
+    rgb[i * 3 + 2] = colors[i];
+  }
+  int wrong = 0;
+  for (int rot = 0; rot < 30; rot += 7) {
+    for (int count = 0; count <= 26; count += 13) {
+      Adafruit_EyeLights d(false, IS3741_BGR);
+      d.begin();
+      d.left_ring.setBrightness(100);
+      d.left_ring.fill(0x777777);
+      for (int i = 0; (i < count) && (i < 24); i++)
+        d.left_ring.setPixelColor((i + rot) % 24, colors[i]);
+      uint32_t hash = pwmHash(chip);
+      d.begin();
+      d.left_ring.fill(0x777777);
+      d.left_ring.setPixels(colors, count, rot);
+      wrong += (pwmHash(chip) != hash);
+      d.begin();
+      d.left_ring.fill(0x777777);
+      d.left_ring.setPixels(rgb, count, rot);
+      wrong += (pwmHash(chip) != hash);
+
+      Adafruit_EyeLights_buffered b(false, IS3741_RGB);
+      b.begin();
+      b.right_ring.setBrightness(200);
+      b.right_ring.fill(0x777777);
+      for (int i = 0; (i < count) && (i < 24); i++)
+        b.right_ring.setPixelColor((i + rot) % 24, colors[i]);
+      b.show();
+      hash = pwmHash(chip);
+      b.begin();
+      b.right_ring.fill(0x777777);
+      b.right_ring.setPixels(colors, count, rot);
+      b.show();
+      wrong += (pwmHash(chip) != hash);
+      b.begin();
+      b.right_ring.fill(0x777777);
+      b.right_ring.setPixels(rgb, count, rot);
+      b.show();
+      wrong += (pwmHash(chip) != hash);
+    }
+  }
+  CHECK_EQUAL(wrong, 0);
+}
+
+// Changing the color order after construction takes effect on the rings
+// too (with IS3741_RING_RAM, their resolved tables are rebuilt)
+static void testOrderChange(void) {
+  Adafruit_EyeLights ref(false, IS3741_GRB);
+  ref.begin();
+  for (int i = 0; i < 24; i++)
+    ref.left_ring.setPixelColor(i, 0x10 << (i % 3 * 8));
+  uint32_t hash = pwmHash(chip);
+
+  Adafruit_EyeLights d(false, IS3741_RGB);
+  d.begin();
+  d.left_ring.setPixelColor(0, 0xFFFFFF); // Table resolved for RGB in use
+  d.begin();
+  const Adafruit_IS31FL3741_ColorOrder grb(IS3741_GRB);
+  d.rOffset = grb.rOffset;
+  d.gOffset = grb.gOffset;
+  d.bOffset = grb.bOffset;
+  for (int i = 0; i < 24; i++)
+    d.left_ring.setPixelColor(i, 0x10 << (i % 3 * 8));
+  CHECK_EQUAL(pwmHash(chip), hash);
+}
+
+int main(void) {
+  srand(7);
+  testRings();
+  testSetPixels();
+  testOrderChange();
+  return testSummary("test_eyelights", chip);
+}
@@ -0,0 +1,202 @@
+// Adafruit_IS31FL3741_FrameReceiver fed from an in-memory Stream: RAW and
+// PIXELS frames, resync after garbage, rejected frames, stall timeout and
+// late polling.
+
+#include "test.h"
+#include <vector>
+
+static FakeIS31FL3741 chip;
+
+// Stream over bytes queued by the test, as if they had already arrived
+class MemStream : public Stream {
+public:
+  void feed(const std::vector<uint8_t> &bytes) {
+    data.insert(data.end(), bytes.begin(), bytes.end());
+  }
+  int available(void) { return data.size() - pos; }
+  int read(void) { return (pos < data.size()) ? data[pos++] : -1; }
+  int peek(void) { return (pos < data.size()) ? data[pos] : -1; }
+  size_t write(uint8_t c) {
+    (void)c;
+    return 0;
+  }
+
+private:
+  std::vector<uint8_t> data;
+  size_t pos = 0;
+};
+
+// Build a frame: sync, type, length, payload and CRC-16/CCITT-FALSE
+static std::vector<uint8_t> frame(uint8_t type,
+                                  const std::vector<uint8_t> &payload) {
+  std::vector<uint8_t> f = {IS3741_FRAME_SYNC1, IS3741_FRAME_SYNC2, type,
+                            (uint8_t)payload.size(),
+                            (uint8_t)(payload.size() >> 8)};
+  f.insert(f.end(), payload.begin(), payload.end());
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 2; i < f.size(); i++) {
+    crc ^= (uint16_t)f[i] << 8;
+    for (uint8_t b = 0; b < 8; b++)
+      crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+  }
+  f.push_back(crc);
+  f.push_back(crc >> 8);
+  return f;
+}
+
+// Random bytes, avoiding the first sync byte so they can't start a frame
+static std::vector<uint8_t> randomBytes(size_t n) {
+  std::vector<uint8_t> v(n);
+  for (size_t i = 0; i < n; i++) {
+    do {
+      v[i] = rand();
+    } while (v[i] == IS3741_FRAME_SYNC1);
+  }
+  return v;
+}
+
+typedef Adafruit_IS31FL3741_FrameReceiver<Adafruit_IS31FL3741_QT_buffered>
+    Receiver;
+
+// Good frames of both types are decoded and shown, one per poll()
+static void testFrames(void) {
+  Adafruit_IS31FL3741_QT_buffered qt, ref;
+  qt.begin();
+  MemStream stream;
+  Receiver rx(qt, stream);
+  CHECK(!rx.poll()); // Nothing yet
+
+  std::vector<uint8_t> raw = randomBytes(351);
+  stream.feed(randomBytes(7)); // Garbage before sync is skipped
+  stream.feed({IS3741_FRAME_SYNC1}); // As is a lone first sync byte
+  stream.feed(frame(IS3741_FRAME_RAW, raw));
+  qt.setRotation(1);
+  std::vector<uint8_t> pixels = randomBytes(qt.width() * qt.height() * 3);
+  stream.feed(frame(IS3741_FRAME_PIXELS, pixels));
+  CHECK(rx.poll());
+  CHECK_EQUAL(pwmDiff(chip, raw.data()), 0);
+  CHECK(rx.poll());
+  CHECK(!rx.poll());
+  CHECK_EQUAL(rx.getFrameCount(), 2);
+  CHECK_EQUAL(rx.getDropCount(), 0);
+
+  ref.begin();
+  memcpy(ref.getBuffer(), raw.data(), 351);
+  ref.setRotation(1);
+  for (int y = 0, i = 0; y < ref.height(); y++) {
+    for (int x = 0; x < ref.width(); x++, i += 3) {
+      ref.setPixelColor(x, y, ((uint32_t)pixels[i] << 16) |
+                                  (pixels[i + 1] << 8) | pixels[i + 2]);
+    }
+  }
+  CHECK(same(qt.getBuffer(), ref.getBuffer()));
+}
+
+// Bad frames are dropped without show(), and the next good one is taken
+static void testDrops(void) {
+  Adafruit_IS31FL3741_QT_buffered qt;
+  qt.begin();
+  qt.show();
+  MemStream stream;
+  Receiver rx(qt, stream);
+  std::vector<uint8_t> raw = randomBytes(351);
+
+  std::vector<uint8_t> bad = frame(IS3741_FRAME_RAW, raw);
+  bad[100] ^= 1; // Corrupt payload, CRC won't match
+  stream.feed(bad);
+  stream.feed(frame(IS3741_FRAME_RAW, randomBytes(350))); // Wrong size
+  stream.feed(frame(7, randomBytes(351)));                // Unknown type
+  uint32_t tx = chip.transactions;
+  CHECK(!rx.poll());
+  CHECK_EQUAL(chip.transactions, tx);
+  CHECK_EQUAL(rx.getDropCount(), 3);
+  CHECK_EQUAL(rx.getFrameCount(), 0);
+
+  stream.feed(frame(IS3741_FRAME_RAW, raw));
+  CHECK(rx.poll());
+  CHECK_EQUAL(pwmDiff(chip, raw.data()), 0);
+}
+
+// A frame that stops arriving mid-way is dropped after the timeout, but
+// bytes that have arrived and merely waited for a late poll() are not a
+// stall
+static void testTimeout(void) {
+  Adafruit_IS31FL3741_QT_buffered qt;
+  qt.begin();
+  MemStream stream;
+  Receiver rx(qt, stream, 100);
+  std::vector<uint8_t> f = frame(IS3741_FRAME_RAW, randomBytes(351));
+
+  // Stall: half a frame, nothing for longer than the timeout
+  stream.feed(std::vector<uint8_t>(f.begin(), f.begin() + 200));
+  CHECK(!rx.poll());
+  delay(50);
+  CHECK(!rx.poll());
+  CHECK_EQUAL(rx.getDropCount(), 0);
+  delay(100);
+  CHECK(!rx.poll());
+  CHECK_EQUAL(rx.getDropCount(), 1);
+  stream.feed(std::vector<uint8_t>(f.begin() + 200, f.end()));
+  CHECK(!rx.poll()); // Rest of the frame is just garbage now
+  CHECK_EQUAL(rx.getFrameCount(), 0);
+
+  // Slow but steady: each part within the timeout of the last
+  stream.feed(std::vector<uint8_t>(f.begin(), f.begin() + 200));
+  CHECK(!rx.poll());
+  delay(90);
+  stream.feed(std::vector<uint8_t>(f.begin() + 200, f.end()));
+  CHECK(rx.poll());
+
+  // Late poll: the rest of the frame arrived in time, but poll() didn't
+  // get to it until well after the timeout
+  stream.feed(std::vector<uint8_t>(f.begin(), f.begin() + 200));
+  CHECK(!rx.poll());
+  stream.feed(std::vector<uint8_t>(f.begin() + 200, f.end()));
+  delay(500);
+  CHECK(rx.poll());
+  CHECK_EQUAL(rx.getFrameCount(), 2);
+  CHECK_EQUAL(rx.getDropCount(), 1);
+}
+
+// Back-to-back frames, alternating RAW and PIXELS, are shown at a rate
+// set by I2C bus time. The stream itself takes no simulated time, so each
+// frame costs one show() of all 351 LEDs. At 9 bits per byte that's at
+// least 3159 bits on the wire; allow 25% on top for register addresses,
+// page switches and start/stop, and require at least that frame rate.
+static void testRate(void) {
+  const uint32_t speeds[] = {100000, 400000, 1000000};
+  const int count = 20;
+  for (uint8_t i = 0; i < 3; i++) {
+    Adafruit_IS31FL3741_QT_buffered qt;
+    qt.begin(); // Sets 400 kHz
+    Wire.setClock(speeds[i]);
+    MemStream stream;
+    Receiver rx(qt, stream);
+    for (int f = 0; f < count; f++) {
+      if (f & 1)
+        stream.feed(frame(IS3741_FRAME_PIXELS,
+                          randomBytes(qt.width() * qt.height() * 3)));
+      else
+        stream.feed(frame(IS3741_FRAME_RAW, randomBytes(351)));
+    }
+    unsigned long t0 = micros();
+    int polls = 0;
+    while (rx.poll() && (++polls < count))
+      ;
+    unsigned long elapsed = micros() - t0;
+    CHECK_EQUAL(rx.getFrameCount(), count);
+    CHECK_EQUAL(rx.getDropCount(), 0);
+    uint32_t floor = speeds[i] / (351 * 9 * 5 / 4);
+    CHECK(elapsed > 0);
+    CHECK(count * 1000000.0 / elapsed >= floor);
+  }
+}
+
+int main(void) {
+  srand(11);
+  testFrames();
+  testDrops();
+  testTimeout();
+  testRate();
+  return testSummary("test_frames", chip);
+}
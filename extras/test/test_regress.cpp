@@ -0,0 +1,170 @@
+// Whole-frame regression test. Draws the same things on every board class
+// (direct and buffered, each color order variant, all four rotations and
+// the legacy glasses classes) and prints a hash of the chip's PWM
+// registers after each step. The Makefile compares the output against
+// test_regress.txt, which was produced by the library before any of the
+// drawing, fill and show() fast paths were added, so those paths must
+// leave the chip in exactly the state the original per-pixel code did.
+
+#include "test.h"
+
+static FakeIS31FL3741 chip;
+
+static void print(const char *name, int rot, const char *step) {
+  if (rot >= 0)
+    printf("%s rot%d %s %08x\n", name, rot, step, pwmHash(chip));
+  else
+    printf("%s %s %08x\n", name, step, pwmHash(chip));
+}
+
+// Direct boards need no show(), this stands in for one
+struct NoShow {
+  void show(void) {}
+};
+
+template <class M> static void fill(M &m, uint16_t c) { m.fill(c); }
+
+static void fill(Adafruit_IS31FL3741_GlassesMatrix &m, uint16_t c) {
+  m.fillScreen(c);
+}
+
+static void fill(Adafruit_IS31FL3741_GlassesMatrix_buffered &m, uint16_t c) {
+  m.fillScreen(c);
+}
+
+template <class M, class S> static void exercise(const char *name, M &m, S &s) {
+  for (int rot = 0; rot < 4; rot++) {
+    m.setRotation(rot);
+    fill(m, 0);
+    uint16_t c = 1;
+    for (int y = 0; y < m.height(); y++) {
+      for (int x = 0; x < m.width(); x++) {
+        m.drawPixel(x, y, c);
+        c = c * 31 + 7;
+      }
+    }
+    m.drawPixel(-1, 0, 0xFFFF); // Off-matrix pixels do nothing
+    m.drawPixel(0, 100, 0xFFFF);
+    s.show();
+    print(name, rot, "px");
+    fill(m, 0xF81F);
+    s.show();
+    print(name, rot, "fill");
+    fill(m, 0x1234);
+    s.show();
+    print(name, rot, "fill2");
+    m.fillRect(1, 1, 4, 3, 0x07E0);
+    m.drawFastHLine(-2, 2, 30, 0x001F);
+    m.drawFastVLine(3, -1, 30, 0xABCD);
+    m.drawLine(0, 0, 12, 8, 0x5555);
+    s.show();
+    print(name, rot, "gfx");
+  }
+  m.setRotation(0);
+}
+
+// Ring and canvas drawing common to direct and buffered EyeLights
+template <class E, class S>
+static void eyeLights(const char *name, E &m, S &s) {
+  for (int i = 0; i < 24; i++) {
+    m.left_ring.setPixelColor(i, 0x123456 * i);
+    m.right_ring.setPixelColor(i, i * 9, i * 7, i * 3);
+  }
+  s.show();
+  print(name, -1, "ring");
+  m.left_ring.setBrightness(77);
+  m.right_ring.fill(0x808080);
+  m.left_ring.fill(1, 2, 250);
+  s.show();
+  print(name, -1, "ringfill");
+  uint16_t *buf = m.getCanvas()->getBuffer();
+  for (int i = 0; i < 54 * 15; i++)
+    buf[i] = i * 2654435761u >> 7;
+  m.scale();
+  s.show();
+  print(name, -1, "scale");
+}
+
+int main(void) {
+  NoShow ns;
+  {
+    Adafruit_IS31FL3741_EVB m;
+    m.begin();
+    exercise("EVB", m, ns);
+  }
+  {
+    Adafruit_IS31FL3741_EVB_buffered m(IS3741_GRB);
+    m.begin();
+    exercise("EVBb", m, m);
+  }
+  {
+    Adafruit_IS31FL3741_QT m;
+    m.begin();
+    exercise("QT", m, ns);
+  }
+  {
+    Adafruit_IS31FL3741_QT m(IS3741_RBG);
+    m.begin();
+    exercise("QTrbg", m, ns);
+  }
+  {
+    Adafruit_IS31FL3741_QT_buffered m;
+    m.begin();
+    exercise("QTb", m, m);
+  }
+  {
+    Adafruit_IS31FL3741_QT_buffered m(IS3741_GBR);
+    m.begin();
+    exercise("QTbgbr", m, m);
+  }
+  {
+    Adafruit_EyeLights m(true);
+    m.begin();
+    exercise("EL", m, ns);
+    eyeLights("EL", m, ns);
+  }
+  {
+    Adafruit_EyeLights_buffered m(true, IS3741_RGB);
+    m.begin();
+    exercise("ELb", m, m);
+    eyeLights("ELb", m, m);
+  }
+  {
+    Adafruit_IS31FL3741_buffered b;
+    b.begin();
+    Adafruit_IS31FL3741_GlassesMatrix_buffered gm(&b, true);
+    Adafruit_IS31FL3741_GlassesLeftRing_buffered lr(&b);
+    exercise("GMb", gm, b);
+    b.show();
+    print("GMb", -1, "show");
+    lr.fill(0x445566);
+    lr.setPixelColor(3, 0xFF0000);
+    b.show();
+    print("GMb", -1, "ring");
+    uint16_t *buf = gm.getCanvas()->getBuffer();
+    for (int i = 0; i < 54 * 15; i++)
+      buf[i] = i * 40503u;
+    gm.scale();
+    b.show();
+    print("GMb", -1, "scale");
+  }
+  {
+    Adafruit_IS31FL3741 b;
+    b.begin();
+    Adafruit_IS31FL3741_GlassesMatrix gm(&b);
+    Adafruit_IS31FL3741_GlassesRightRing rr(&b);
+    exercise("GM", gm, ns);
+    rr.fill(0x00FF00);
+    rr.setPixelColor(5, 0x0000FF);
+    print("GM", -1, "ring");
+    b.setLEDscaling(0x80);
+    b.setLEDscaling(5, 0x11);
+    uint32_t h = 2166136261u;
+    for (uint16_t i = 0; i < 351; i++) {
+      h ^= chip.scaling(i);
+      h *= 16777619u;
+    }
+    printf("scal %08x\n", h);
+  }
+  return testSummary("test_regress", chip);
+}